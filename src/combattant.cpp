@@ -24,23 +24,11 @@ void Combattant::InitStats(int maxHP, int AT, int DE, int AG, int XP, Faction fa
     _XPvalue = XP;
 };
 
-// check if combattant is allowed to movehttps://github.com/SebastianMoerz/CppND_DungeonsOfEllemere
-bool Combattant::isMyTurnToMove() 
+// check if combattant is allowed to attack at the given tick
+bool Combattant::isMyTurnToAttack(std::uint64_t tick) 
 {
-  ++_turnCounterMove;
-  ++_turnCounterAttack;        
-  if (_turnCounterMove > moveBaseSpeed_- _agility) {    
-    _turnCounterMove = 0;
-    return true;
-  }
-  return false;
-}
-
-// check if combattant is allowed to attack
-bool Combattant::isMyTurnToAttack() 
-{
-  if (_turnCounterAttack > (moveBaseSpeed_ - _agility) * moveStepsPerCombatRound_) {
-    _turnCounterAttack = 0;
+  if (tick >= _nextAttackTick) {
+    _nextAttackTick = tick + GetAttackInterval();
     return true;
   }
   return false;
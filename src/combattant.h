@@ -1,6 +1,7 @@
 #ifndef COMBATTANT_H
 #define COMBATTANT_H
 
+#include <cstdint>
 #include <string>
 
 // base class for objects that can engage in combat
@@ -16,8 +17,12 @@ class Combattant {
         // main combat functions
         void Heal(int i);           // instance heals "i" hit points
         void TakeDamage(int i);     // instance takes "i" points of damage
-        bool isMyTurnToMove();
-        bool isMyTurnToAttack();        
+        
+        // turns: combattants move once per move interval (see TurnScheduler) and may attack once per attack interval (in ticks)
+        int GetMoveInterval() const { return moveBaseSpeed_ - _agility + 1; }
+        int GetAttackInterval() const { return (moveBaseSpeed_ - _agility) * moveStepsPerCombatRound_ + 1; }
+        void StartTurns(std::uint64_t tick) { _nextAttackTick = tick + GetAttackInterval(); }   // combattant enters the game at tick
+        bool isMyTurnToAttack(std::uint64_t tick);
     
         // setters & getters
         void SetFaction(Faction faction) { _faction=faction; }
@@ -26,14 +31,14 @@ class Combattant {
         int GetXPValue () { return _XPvalue; }        
         int GetAttackBase() { return _attack_base; } 
         int GetDefenseBase() { return _defense_base;}
-        int GetMaxHP() { return _maxHitPoints;}
-        int GetHP() { return _hitPoints;}
+        int GetMaxHP() const { return _maxHitPoints;}
+        int GetHP() const { return _hitPoints;}
 
         // virtual as long as NPCs don't have any items that alter their stats
         virtual int GetAttackValue () = 0;
         virtual int GetDefenseValue () = 0;
 
-        // how many frames must pass before next turn?
+        // how many ticks must pass before next turn?
         static int constexpr moveBaseSpeed_ = 20;
         static int constexpr moveStepsPerCombatRound_ = 4;
 
@@ -49,9 +54,8 @@ class Combattant {
         int _agility{0};
         int _XPvalue{0};        // how much XP will the player gain for defeating this opponent?      
 
-        // counter
-        int _turnCounterMove{0};
-        int _turnCounterAttack{0};
+        // turns
+        std::uint64_t _nextAttackTick{0};
 };
 
 #endif
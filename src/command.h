@@ -0,0 +1,15 @@
+#ifndef COMMAND_H
+#define COMMAND_H
+
+#include <cstdint>
+
+// player & game commands. controllers translate their input into commands, which are applied by the game (see Game::ApplyInput). 
+// recorded sessions store commands as well (see InputLog), so live & replayed input take the same path
+enum class Command : std::uint8_t { 
+  kQuit, kPause, 
+  kUp, kDown, kLeft, kRight, 
+  kStatus, kInventory, 
+  kSelectItem1, kSelectItem2, kSelectItem3, kSelectItem4, kSelectItem5, kSelectItem6, kSelectItem7, kSelectItem8, kSelectItem9
+};
+
+#endif
@@ -1,13 +1,19 @@
 #ifndef CONTROLLER_H
 #define CONTROLLER_H
 
-#include "player.h"
+#include <cstdint>
+#include <vector>
+#include "command.h"
 
+// input & time source of the game loop. implemented by the SDL front end (SdlController) and by HeadlessController
 class Controller {
  public:
-  void HandleInput(bool &running, bool &paused, Player &player) const;
+  virtual ~Controller() = default;
 
- private:  
+  // time in ms
+  virtual std::uint32_t GetTicks() = 0;
+  // block until input arrives or timeout (in ms) has passed, then append the commands of all pending input
+  virtual void WaitForInput(std::uint32_t timeout, std::vector<Command> &commands) = 0;
 };
 
-#endif
\ No newline at end of file
+#endif
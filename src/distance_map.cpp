@@ -0,0 +1,65 @@
+#include "distance_map.h"
+
+// directional deltas
+static const int delta[4][2]{{-1, 0}, {0, -1}, {1, 0}, {0, 1}};
+
+// recompute all distances to source (all moves cost 1, so a breadth-first search is equivalent to dijkstra)
+void DistanceMap::Update(OccupancyGrid const &grid, Point source) {
+  _width = grid.GetWidth();
+  _height = grid.GetHeight();
+  _source = source;
+  _revision = grid.GetRevision();
+  _valid = true;
+  _distance.assign(_width * _height, kUnreachable);
+  _queue.clear();
+  if (!IsOnMap(source)) { return; }
+
+  _queue.reserve(_distance.size());
+  _distance[source.y * _width + source.x] = 0;
+  _queue.push_back(source.y * _width + source.x);
+
+  for (std::size_t head = 0; head < _queue.size(); head++) {
+    int const cell = _queue[head];
+    int const x = cell % _width;
+    int const y = cell / _width;
+    int const d = _distance[cell] + 1;
+
+    for (int i = 0; i < 4; i++) {
+      int const x2 = x + delta[i][0];
+      int const y2 = y + delta[i][1];
+      if (grid.IsBlocked({x2, y2}, OccupancyGrid::kStatic)) { continue; }
+
+      int const neighbor = y2 * _width + x2;
+      if (_distance[neighbor] != kUnreachable) { continue; }
+      _distance[neighbor] = d;
+      _queue.push_back(neighbor);
+    }
+  }
+}
+
+// false if the source has moved or the static obstacles have changed since the last update
+bool DistanceMap::isUpToDate(OccupancyGrid const &grid, Point source) const {
+  return _valid && _revision == grid.GetRevision() && _source.x == source.x && _source.y == source.y;
+}
+
+// returns the neighbor of "from" which is closest to the source
+Point DistanceMap::NextStep(Point from) const {
+  Point best = from;
+  int bestDistance = GetDistance(from);
+
+  for (int i = 0; i < 4; i++) {
+    Point neighbor{from.x + delta[i][0], from.y + delta[i][1]};
+    int d = GetDistance(neighbor);
+    if (d == kUnreachable) { continue; }
+    if (bestDistance == kUnreachable || d < bestDistance) {
+      best = neighbor;
+      bestDistance = d;
+    }
+  }
+  return best;
+}
+
+int DistanceMap::GetDistance(Point point) const {
+  if (!IsOnMap(point)) { return kUnreachable; }
+  return _distance[point.y * _width + point.x];
+}
@@ -0,0 +1,40 @@
+#ifndef DISTANCE_MAP_H
+#define DISTANCE_MAP_H
+
+#include <vector>
+#include "point.h"
+#include "occupancy_grid.h"
+
+// breadth-first distance field ("flow field") around a single source tile, e.g. the player's position.
+// computed once whenever the source moves or obstacles change, then shared by all opponents: 
+// finding the next step toward the source is a lookup of the four neighboring distances
+class DistanceMap {
+ public:
+  static int constexpr kUnreachable = -1;
+
+  // recompute all distances to source. tiles occupied by one of the grid's static layers are impassable
+  void Update(OccupancyGrid const &grid, Point source);
+
+  // false if the source has moved or the static obstacles have changed since the last update
+  bool isUpToDate(OccupancyGrid const &grid, Point source) const;
+  
+  // returns the neighbor of "from" which is closest to the source (or "from" itself, if the source can't be reached)
+  Point NextStep(Point from) const;
+
+  // getters
+  int GetDistance(Point point) const;
+  Point GetSource() const { return _source; }
+
+ private:
+  bool IsOnMap(Point point) const { return point.x >= 0 && point.y >= 0 && point.x < _width && point.y < _height; }
+
+  int _width{0};
+  int _height{0};
+  Point _source{-1, -1};
+  unsigned int _revision{0};      // revision of the occupancy grid the distances were computed for
+  bool _valid{false};
+  std::vector<int> _distance{};   // distance to source per tile, indexed by y * width + x
+  std::vector<int> _queue{};      // BFS queue, kept between updates to avoid reallocation
+};
+
+#endif
@@ -2,43 +2,43 @@
 #include <iostream>
 
 // constructs a door if size 2x1, composed of two entities "wing" and "anchor"
-Door::Door(int x, int y, bool horizontal, bool secret, bool locked) : _anchor(x,y,Entity::Type::kObstacle), _wing(x,y,Entity::Type::kObstacle), _horizontal(horizontal) {
+Door::Door(EntityStore &store, int x, int y, bool horizontal, bool secret, bool locked) : _anchor(store,x,y,Entity::Type::kDoor), _wing(store,x,y,Entity::Type::kDoor), _horizontal(horizontal) {
            
     // set _wing position depending on door orientation
     if (horizontal) { _wing.SetPosition({x+1,y}); }
     if (!horizontal) { _wing.SetPosition({x,y+1}); }            
 
     if (locked) { _state = State::kLocked; }
-    if (secret) { _type = DoorType::kSecret; }
+    SetDoorType(secret ? DoorType::kSecret : DoorType::kRegular);
 };
 
 // main interface
 void Door::Interact(Player *player) {
     if (_state == State::kOpen) { return; }
 
-    std::cout << "---------------" << std::endl;
+    player->Messages() << "---------------" << std::endl;
 
     if ( _type == DoorType::kSecret ) {       
         std::string isLocked = ( _state == State::kLocked ) ? "locked" : "unlocked";
-        std::cout << "You found a secret door! It appears to be " << isLocked << "." << std::endl;
-        _type = DoorType::kDiscovered;
+        player->Messages() << "You found a secret door! It appears to be " << isLocked << "." << std::endl;
+        SetDoorType(DoorType::kDiscovered);
         return;
     }
 
     if ( _state == State::kLocked ) {
                 
         if (player->hasKey()) {
-            std::cout << "You used the key to unlock the door." << std::endl;
+            player->Messages() << "You used the key to unlock the door." << std::endl;
             _state = State::kClosed;
         }
         else {
-            std::cout << "The door is locked. Without a key there is no way to open it." << std::endl;
+            player->Messages() << "The door is locked. Without a key there is no way to open it." << std::endl;
         }
         return;
     }
 
     if ( _state == State::kClosed) {
-        std::cout << "You use all your weight to move the rusted hinges. Slowly the door creaks open." << std::endl;
+        player->Messages() << "You use all your weight to move the rusted hinges. Slowly the door creaks open." << std::endl;
         OpenDoor();
         _state = State::kOpen;
          return;
@@ -59,4 +59,11 @@ void Door::OpenDoor() {
         _anchor.SetPosition({x+1,y-1});
         _wing.SetPosition({x+2,y-1});   
     }
-};
\ No newline at end of file
+};
+
+// private method: the door type determines how anchor & wing are rendered
+void Door::SetDoorType(DoorType type) {
+    _type = type;
+    _anchor.SetVariant(static_cast<std::uint8_t>(type));
+    _wing.SetVariant(static_cast<std::uint8_t>(type));
+}
@@ -12,19 +12,22 @@ class Door {
         enum class DoorType { kRegular, kSecret, kDiscovered };
 
         // constructs a door if size 2x1, composed of two entities "wing" and "anchor"
-        Door(int x, int y, bool horizontal, bool secret, bool locked);
+        Door(EntityStore &store, int x, int y, bool horizontal, bool secret, bool locked);
         
         // main interface
         void Interact(Player *player);        
 
         //getters
-        SDL_Point GetWingPosition() { return _wing.GetPosition(); }
-        SDL_Point GetAnchorPosition() { return _anchor.GetPosition(); }
+        Entity* GetAnchor() { return &_anchor; }
+        Entity* GetWing() { return &_wing; }
+        Point GetWingPosition() { return _wing.GetPosition(); }
+        Point GetAnchorPosition() { return _anchor.GetPosition(); }
         DoorType GetDoorType() { return _type; }
   
 
     private:             
         void OpenDoor();        
+        void SetDoorType(DoorType type);    // also sets the appearance of anchor & wing
         Entity _anchor;
         Entity _wing;
         State _state{State::kClosed};
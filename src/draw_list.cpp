@@ -0,0 +1,28 @@
+#include "draw_list.h"
+
+// add rectangle to the group of its color
+void DrawList::Add(SDL_Rect const &rect, Uint32 color) {
+  if (_last >= _used || _groups[_last].color != color) {
+    // the number of colors per frame is small, so a linear search is fine
+    _last = 0;
+    while (_last < _used && _groups[_last].color != color) { _last++; }
+    if (_last == _used) {
+      if (_used == _groups.size()) { _groups.emplace_back(); }
+      _groups[_used].color = color;
+      _groups[_used].rects.clear();
+      _used++;
+    }
+  }
+  _groups[_last].rects.push_back(rect);
+}
+
+// draw all groups and clear the list
+void DrawList::Submit(SDL_Renderer *renderer) {
+  for (std::size_t i = 0; i < _used; i++) {
+    Group const &group = _groups[i];
+    SDL_SetRenderDrawColor(renderer, (group.color >> 16) & 0xFF, (group.color >> 8) & 0xFF, group.color & 0xFF, (group.color >> 24) & 0xFF);
+    SDL_RenderFillRects(renderer, group.rects.data(), static_cast<int>(group.rects.size()));
+  }
+  _used = 0;
+  _last = 0;
+}
@@ -0,0 +1,27 @@
+#ifndef DRAW_LIST_H
+#define DRAW_LIST_H
+
+#include <vector>
+#include "SDL.h"
+
+// collects the filled rectangles of a frame and submits them grouped by color, with one SDL_RenderFillRects call per color
+// groups are submitted in the order their color was first added, so a later group is drawn on top of an earlier one
+class DrawList {
+ public:
+  // color as 0xAARRGGBB
+  void Add(SDL_Rect const &rect, Uint32 color);
+  // draw all groups and clear the list. memory is kept for the next frame
+  void Submit(SDL_Renderer *renderer);
+
+ private:
+  struct Group {
+    Uint32 color;
+    std::vector<SDL_Rect> rects;
+  };
+
+  std::vector<Group> _groups{};   // the first _used groups hold this frame's rectangles, the others are kept for reuse
+  std::size_t _used{0};
+  std::size_t _last{0};           // group of the previous Add, since consecutive rectangles often share their color
+};
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef ENTITY_H
 #define ENTITY_H
 
-#include "SDL.h"
+#include "point.h"
 #include "tiletypes.h"
+#include "entity_store.h"
+#include "occupancy_grid.h"
 #include <string>
 
 // inventory items can be used by instances of Entity's child classes
@@ -21,33 +23,52 @@ struct InventoryItem {
 };
 
 // base class for objects on the game map (no separate .cpp file due to trivial member definition)
+// an entity is a handle to its slot in an EntityStore, which holds the entity's position, type and flags
 class Entity {
  public:
   // used e.g. for rendering and for defining behavioral detail in child classes (currently not all types are used)
-  enum class Type { kNone, kEvent, kObstacle, kDoor, kTreasure, kLoot, kChest, kNPC, kPlayer }; 
+  enum class Type { kNone, kEvent, kObstacle, kDoor, kTreasure, kLoot, kChest, kNPC, kPlayer, kOpponent }; 
 
   // for movement
   enum class Direction { kUp, kDown, kLeft, kRight, kNone };              
     
   // constructor
-  Entity(){};
-  Entity(int x, int y, Type type) : _position({x,y}), _type(type) { if (type == Type::kEvent) { _blocksPath = false;} }
+  Entity(EntityStore &store, int x, int y, Type type) : _store(&store) { 
+    std::uint8_t flags = (type == Type::kEvent) ? EntityStore::kNone : EntityStore::kBlocksPath;
+    _slot = store.Create(this, {x,y}, static_cast<std::uint8_t>(type), flags);
+  }
+
+  // registered entities are removed from the obstacle map's entity index on destruction. copying is disabled, since the index and the store refer to the instance
+  ~Entity() { 
+    if (_grid != nullptr) { _grid->Unregister(this); } 
+    _store->Destroy(_slot);
+  }
+  Entity(const Entity &source) = delete;
+  Entity &operator=(const Entity &source) = delete;
   
   // getters and setters
-  void SetType(Type const &type) {_type = type;}
-  Type GetType() {return _type;}
-  void SetPosition(SDL_Point const &position) {_position = position;}
-  SDL_Point GetPosition() {return _position;}
-  void MarkForErasure () { _eraseFlag = true; }
-  bool isMarkedForErasure () { return _eraseFlag; }
-  void SetBlocksPath(bool blocksPath) { _blocksPath = blocksPath; }
-  bool GetBlocksPath() { return _blocksPath; } 
+  void SetType(Type const &type) { _store->SetType(_slot, static_cast<std::uint8_t>(type)); }
+  Type GetType() { return static_cast<Type>(_store->GetType(_slot)); }
+  void SetPosition(Point const &position) {
+    if (_grid != nullptr) { _grid->Move(this, position); }  // keep the per-tile entity index up to date
+    _store->SetPosition(_slot, position);
+  }
+  Point GetPosition() { return _store->GetPosition(_slot); }
+  void MarkForErasure () { _store->SetFlag(_slot, EntityStore::kErase, true); }         // if set, instance will be deleted at end of game loop 
+  bool isMarkedForErasure () { return _store->HasFlag(_slot, EntityStore::kErase); }
+  void SetBlocksPath(bool blocksPath) { _store->SetFlag(_slot, EntityStore::kBlocksPath, blocksPath); }   // if set, moving objects can't move at instance's position
+  bool GetBlocksPath() { return _store->HasFlag(_slot, EntityStore::kBlocksPath); } 
+  void SetVariant(std::uint8_t variant) { _store->SetVariant(_slot, variant); }
+  int GetSlot() { return _slot; }
 
 private:
-  Type _type{Type::kNone};
-  SDL_Point _position{0,0}; 
-  bool _eraseFlag{false};     // if true, instance will be deleted at end of game loop 
-  bool _blocksPath{true};     // if true, moving objects can't move at instance's position
+  EntityStore *_store;
+  int _slot;
+
+  // set by OccupancyGrid::Register
+  friend class OccupancyGrid;
+  OccupancyGrid *_grid{nullptr};
+  int _gridNode{0};
 };
 
-#endif
\ No newline at end of file
+#endif
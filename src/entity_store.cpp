@@ -0,0 +1,41 @@
+#include "entity_store.h"
+
+// reserve memory for n entities
+void EntityStore::Reserve(std::size_t n) {
+  _positions.reserve(n);
+  _types.reserve(n);
+  _flags.reserve(n);
+  _variants.reserve(n);
+  _entities.reserve(n);
+}
+
+// allocate a slot (reusing a freed one if possible) and initialize its components
+int EntityStore::Create(Entity *entity, Point position, std::uint8_t type, std::uint8_t flags) {
+  int slot;
+  if (!_freeSlots.empty()) {
+    slot = _freeSlots.back();
+    _freeSlots.pop_back();
+  }
+  else {
+    slot = GetSize();
+    _positions.emplace_back();
+    _types.emplace_back();
+    _flags.emplace_back();
+    _variants.emplace_back();
+    _entities.emplace_back();
+  }
+  _positions[slot] = position;
+  _types[slot] = type;
+  _flags[slot] = flags;
+  _variants[slot] = 0;
+  _entities[slot] = entity;
+  ++_revision;
+  return slot;
+}
+
+void EntityStore::Destroy(int slot) {
+  _entities[slot] = nullptr;
+  _flags[slot] = kNone;
+  _freeSlots.push_back(slot);
+  ++_revision;
+}
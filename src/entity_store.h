@@ -0,0 +1,55 @@
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <cstdint>
+#include <vector>
+#include "point.h"
+
+class Entity;
+
+// contiguous storage of the data of all entities that is read every frame (structure of arrays: one array per component, indexed by slot)
+// every Entity owns one slot for its lifetime, so slots are stable handles. freed slots are reused by the next entity created
+// update and render passes can iterate over the slots linearly instead of following pointers to the individual objects
+// every change of visible data (position, type, variant, creation & destruction) increments the revision, so the game can tell whether a frame needs to be redrawn
+class EntityStore {
+ public:
+  enum Flags : std::uint8_t { kNone = 0, kErase = 1, kBlocksPath = 2 };
+
+  // reserve memory for n entities, e.g. before a level is loaded
+  void Reserve(std::size_t n);
+
+  // allocate / free a slot. called by the constructor / destructor of Entity
+  int Create(Entity *entity, Point position, std::uint8_t type, std::uint8_t flags);
+  void Destroy(int slot);
+
+  // component access. type holds an Entity::Type, variant a type specific appearance (e.g. Door::DoorType)
+  Point GetPosition(int slot) const { return _positions[slot]; }
+  void SetPosition(int slot, Point position) { 
+    if (_positions[slot].x == position.x && _positions[slot].y == position.y) { return; }
+    _positions[slot] = position; 
+    ++_revision;
+  }
+  std::uint8_t GetType(int slot) const { return _types[slot]; }
+  void SetType(int slot, std::uint8_t type) { _types[slot] = type; ++_revision; }
+  bool HasFlag(int slot, Flags flag) const { return (_flags[slot] & flag) != 0; }
+  void SetFlag(int slot, Flags flag, bool value) { _flags[slot] = value ? (_flags[slot] | flag) : (_flags[slot] & ~flag); }
+  std::uint8_t GetVariant(int slot) const { return _variants[slot]; }
+  void SetVariant(int slot, std::uint8_t variant) { _variants[slot] = variant; ++_revision; }
+  Entity *GetEntity(int slot) const { return _entities[slot]; }
+
+  // number of slots (including free ones) and check if a slot is in use. iterate 0 ... GetSize()-1 and skip free slots
+  int GetSize() const { return static_cast<int>(_entities.size()); }
+  bool isLive(int slot) const { return _entities[slot] != nullptr; }
+  unsigned int GetRevision() const { return _revision; }
+
+ private:
+  std::vector<Point> _positions{};
+  std::vector<std::uint8_t> _types{};
+  std::vector<std::uint8_t> _flags{};
+  std::vector<std::uint8_t> _variants{};
+  std::vector<Entity*> _entities{};     // the object a slot belongs to, nullptr for free slots
+  std::vector<int> _freeSlots{};
+  unsigned int _revision{0};
+};
+
+#endif
@@ -2,30 +2,30 @@
 
 
 void MapEvent::AddToArea(int x, int y) {
-    if (!isInArea(x,y)) { _area.emplace_back(std::make_unique<Entity>(x,y,Entity::Type::kEvent)); }
+    std::uint64_t key = TileKey(x,y);
+    auto it = std::lower_bound(_area.begin(), _area.end(), key);
+    if (it != _area.end() && *it == key) { return; }
+    _area.insert(it, key);
+    if (_triggers != nullptr) { _triggers->Add(this, {x,y}); }
 }
         
 void MapEvent::RemoveFromArea(int x, int y) {
-    while (true) {
-        auto it = std::find_if(_area.begin(), _area.end(), [&](const std::unique_ptr<Entity>& item) { return (item->GetPosition().x == x && item->GetPosition().y == y);});
-        if (it == _area.end()) { return; }
-        else { _area.erase(it); }
-    }
+    std::uint64_t key = TileKey(x,y);
+    auto it = std::lower_bound(_area.begin(), _area.end(), key);
+    if (it == _area.end() || *it != key) { return; }
+    _area.erase(it);
+    if (_triggers != nullptr) { _triggers->Remove(this, {x,y}); }
 }
 
-bool MapEvent::isInArea(int x, int y) {
-    for (std::unique_ptr<Entity> &entity : _area) {
-        if (entity->GetPosition().x == x && entity->GetPosition().y == y) { return true; }
-    }
-    return false;
+bool MapEvent::isInArea(int x, int y) const {
+    return std::binary_search(_area.begin(), _area.end(), TileKey(x,y));
 }
 
-std::vector<SDL_Point> MapEvent::GetArea() {
-    std::vector<SDL_Point> positions{};
-    for (std::unique_ptr<Entity> &tile : _area) {
-        positions.push_back(tile->GetPosition());
-    }
-   return positions;
+std::vector<Point> MapEvent::GetArea() const {
+    std::vector<Point> area;
+    area.reserve(_area.size());
+    for (std::uint64_t key : _area) { area.push_back(TilePoint(key)); }
+    return area;
 }
 
 void MapEvent::Interact(Player *player) {
@@ -36,10 +36,10 @@ void MapEvent::Interact(Player *player) {
         // check if all tiles belonging to the quest were visited
         if (_area.empty()) {
             
-            if (_msg != "") { std::cout << "---------------" << std::endl << _msg << std::endl;}
+            if (_msg != "") { player->Messages() << "---------------" << std::endl << _msg << std::endl;}
             if (_xp != 0) { player->ReceiveXP(_xp); } 
-            if (_dmg < 0) { player->Heal(_dmg); ; std::cout << "You heal " << -(_dmg) << " hit points." << std::endl; }
-            if (_dmg > 0) { player->TakeDamage (_dmg); std::cout << "You take " << _dmg << " points of damage." << std::endl;}
+            if (_dmg < 0) { player->Heal(_dmg); ; player->Messages() << "You heal " << -(_dmg) << " hit points." << std::endl; }
+            if (_dmg > 0) { player->TakeDamage (_dmg); player->Messages() << "You take " << _dmg << " points of damage." << std::endl;}
             
             // delete event if quest is completed
             this->MarkForErasure();
@@ -48,16 +48,16 @@ void MapEvent::Interact(Player *player) {
     }
 
     if (_type == EventType::kIllumination) {
-        if (_msg != "") { std::cout << "---------------" << std::endl << _msg << std::endl;}
+        if (_msg != "") { player->Messages() << "---------------" << std::endl << _msg << std::endl;}
         player->SetVision(_illumination);
         return;
     }
 
     // for kSingle and kPersistent
-    std::cout << "---------------" << std::endl << _msg << std::endl;
-    if (_xp != 0) { player->ReceiveXP(_xp); } // std::cout << "You receive " << _xp << " experience points." << std::endl; }
-    if (_dmg < 0) { player->Heal(_dmg); ; std::cout << "You heal " << -(_dmg) << " hit points." << std::endl; }
-    if (_dmg > 0) { player->TakeDamage (_dmg); std::cout << "You take " << _dmg << " points of damage." << std::endl;}
+    player->Messages() << "---------------" << std::endl << _msg << std::endl;
+    if (_xp != 0) { player->ReceiveXP(_xp); } // player->Messages() << "You receive " << _xp << " experience points." << std::endl; }
+    if (_dmg < 0) { player->Heal(_dmg); ; player->Messages() << "You heal " << -(_dmg) << " hit points." << std::endl; }
+    if (_dmg > 0) { player->TakeDamage (_dmg); player->Messages() << "You take " << _dmg << " points of damage." << std::endl;}
 
     // delete event from game if type is kSingle
     if (_type == EventType::kSingle ) { this->MarkForErasure(); }
@@ -2,7 +2,9 @@
 #define MAP_EVENT_H
 
 #include "entity.h"
+#include "event_trigger_map.h"
 #include "player.h"
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <iostream>
@@ -15,35 +17,46 @@ class MapEvent : public Entity {
         enum class EventType { kSingle, kPersitent, kIllumination, kCollectionQuest };
 
         // constructors for one-time events (Type kSingle)
-        MapEvent(int x, int y, std::string msg) : Entity(x,y,Entity::Type::kEvent), _msg(msg) { AddToArea(x,y); }                  
-        MapEvent(int x, int y, std::string msg, int xp, int dmg) : Entity(x,y,Entity::Type::kEvent), _msg(msg), _xp(xp), _dmg(dmg) { AddToArea(x,y); }
+        MapEvent(EntityStore &store, int x, int y, std::string msg) : Entity(store,x,y,Entity::Type::kEvent), _msg(msg) { AddToArea(x,y); }                  
+        MapEvent(EntityStore &store, int x, int y, std::string msg, int xp, int dmg) : Entity(store,x,y,Entity::Type::kEvent), _msg(msg), _xp(xp), _dmg(dmg) { AddToArea(x,y); }
 
         // constructors for persistent events and side quests
-        MapEvent(int x, int y, EventType type, std::string msg) : Entity(x,y,Entity::Type::kEvent), _msg(msg), _type(type) { AddToArea(x,y); }
-        MapEvent(int x, int y, EventType type, std::string msg, int xp, int dmg) : Entity(x,y,Entity::Type::kEvent), _msg(msg), _xp(xp), _dmg(dmg), _type(type) { AddToArea(x,y); }
+        MapEvent(EntityStore &store, int x, int y, EventType type, std::string msg) : Entity(store,x,y,Entity::Type::kEvent), _msg(msg), _type(type) { AddToArea(x,y); }
+        MapEvent(EntityStore &store, int x, int y, EventType type, std::string msg, int xp, int dmg) : Entity(store,x,y,Entity::Type::kEvent), _msg(msg), _xp(xp), _dmg(dmg), _type(type) { AddToArea(x,y); }
 
         // constructor for events that change map illumination (illumination events are persistent)
-        MapEvent(int x, int y, Player::Vision vision, std::string msg) : Entity(x,y,Entity::Type::kEvent), _msg(msg), _type(EventType::kIllumination), _illumination(vision) { AddToArea(x,y); }       
+        MapEvent(EntityStore &store, int x, int y, Player::Vision vision, std::string msg) : Entity(store,x,y,Entity::Type::kEvent), _msg(msg), _type(EventType::kIllumination), _illumination(vision) { AddToArea(x,y); }       
         
 
+        // registered events are removed from the trigger map on destruction
+        ~MapEvent() { if (_triggers != nullptr) { _triggers->Unregister(this); } }
+
+        // the area is the set of tiles on which the event is triggered. changes are passed on to the trigger map
         void AddToArea(int x, int y);
         
         void RemoveFromArea(int x, int y);
 
-        bool isInArea(int x, int y);
+        bool isInArea(int x, int y) const;
 
-        std::vector<SDL_Point> GetArea();
+        std::vector<Point> GetArea() const;     // tiles of the area, ordered by x, then y
 
         void Interact(Player *player);    
 
     private:
         EventType _type{EventType::kSingle};
-        std::vector<std::unique_ptr<Entity>> _area;
+        std::vector<std::uint64_t> _area;   // coordinates of the area's tiles (see TileKey), sorted for binary search
+        static std::uint64_t TileKey(int x, int y) { return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y); }
+        static Point TilePoint(std::uint64_t key) { return {static_cast<int>(static_cast<std::uint32_t>(key >> 32)), static_cast<int>(static_cast<std::uint32_t>(key))}; }
         std::string _msg{""};
         int _xp{0};
         int _dmg{0};        
         Player::Vision _illumination{Player::Vision::kDaylight};
 
+        // set by EventTriggerMap::Register
+        friend class EventTriggerMap;
+        EventTriggerMap *_triggers{nullptr};
+        unsigned _triggerId{0};
+
 };
 
 #endif
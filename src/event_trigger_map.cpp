@@ -0,0 +1,49 @@
+#include "event_trigger_map.h"
+#include "event.h"
+
+#include <algorithm>
+
+// set size and clear the index
+void EventTriggerMap::Init(int width, int height) {
+  _width = width;
+  _height = height;
+  _nextId = 0;
+  _tiles.clear();
+}
+
+std::vector<MapEvent*> const &EventTriggerMap::GetEvents(Point point) const {
+  if (!IsOnMap(point)) { return _none; }
+  auto it = _tiles.find(point.y * _width + point.x);
+  return it != _tiles.end() ? it->second : _none;
+}
+
+// add all tiles of an event's area to the index
+void EventTriggerMap::Register(MapEvent *event) {
+  event->_triggers = this;
+  event->_triggerId = _nextId++;
+  for (Point const &point : event->GetArea()) { Add(event, point); }
+}
+
+// remove all tiles of an event's area from the index
+void EventTriggerMap::Unregister(MapEvent *event) {
+  for (Point const &point : event->GetArea()) { Remove(event, point); }
+  event->_triggers = nullptr;
+}
+
+// insert event into the list of a tile. the list is kept in order of registration, so events are triggered in the order they were placed
+void EventTriggerMap::Add(MapEvent *event, Point point) {
+  if (!IsOnMap(point)) { return; }
+  std::vector<MapEvent*> &events = _tiles[point.y * _width + point.x];   // creates the entry of a tile covered for the first time
+  auto it = std::upper_bound(events.begin(), events.end(), event, [](MapEvent const *a, MapEvent const *b) { return a->_triggerId < b->_triggerId; });
+  events.insert(it, event);
+}
+
+// the entry of a tile is dropped once no event covers it anymore
+void EventTriggerMap::Remove(MapEvent *event, Point point) {
+  if (!IsOnMap(point)) { return; }
+  auto it = _tiles.find(point.y * _width + point.x);
+  if (it == _tiles.end()) { return; }
+  std::vector<MapEvent*> &events = it->second;
+  events.erase(std::remove(events.begin(), events.end(), event), events.end());
+  if (events.empty()) { _tiles.erase(it); }
+}
@@ -0,0 +1,38 @@
+#ifndef EVENT_TRIGGER_MAP_H
+#define EVENT_TRIGGER_MAP_H
+
+#include <unordered_map>
+#include <vector>
+#include "point.h"
+
+class MapEvent;
+
+// sparse per-tile index of map events: the tiles covered by an event area (row-major index = y * width + x) are mapped to the events
+// covering them, so finding the events triggered by a step is a single lookup. most tiles are not covered by any event and take no memory
+// events keep the index up to date themselves: see MapEvent::AddToArea / RemoveFromArea
+class EventTriggerMap {
+ public:
+  // set size and clear the index. to be called before any event is registered
+  void Init(int width, int height);
+
+  // add / remove all tiles of an event's area to / from the index
+  void Register(MapEvent *event);
+  void Unregister(MapEvent *event);
+  // add / remove a single tile of a registered event. called by MapEvent::AddToArea / RemoveFromArea
+  void Add(MapEvent *event, Point point);
+  void Remove(MapEvent *event, Point point);
+
+  // events covering point, in order of registration
+  std::vector<MapEvent*> const &GetEvents(Point point) const;
+
+ private:
+  bool IsOnMap(Point point) const { return point.x >= 0 && point.y >= 0 && point.x < _width && point.y < _height; }
+
+  int _width{0};
+  int _height{0};
+  unsigned _nextId{0};                          // registration order, used to keep the events of a tile sorted
+  std::unordered_map<int, std::vector<MapEvent*>> _tiles{};   // covered tiles only, by index
+  std::vector<MapEvent*> _none{};               // returned for tiles without events
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include "field_of_view.h"
+
+#include <algorithm>
+
+// recompute the visible tiles: the origin is always visible, each of the eight octants is scanned separately
+void FieldOfView::Update(TerrainMap const &terrain, OccupancyGrid const &grid, Point origin, int radius) {
+  static int constexpr kOctants[8][4] = {{1, 0, 0, 1}, {0, 1, 1, 0}, {0, -1, 1, 0}, {-1, 0, 0, 1},
+                                         {-1, 0, 0, -1}, {0, -1, -1, 0}, {0, 1, -1, 0}, {1, 0, 0, -1}};
+  _origin = origin;
+  _radius = std::clamp(radius, 0, kMaxRadius);
+  _revision = grid.GetRevision();
+  _valid = true;
+  _updates++;
+
+  _visible.fill(0);
+  SetVisible(0, 0);
+  for (auto const &octant : kOctants) { CastLight(terrain, grid, 1, 1.0, 0.0, octant[0], octant[1], octant[2], octant[3]); }
+
+  // the octants are scanned row by row up to the radius, i.e. within a square. clip the result to the circle of the radius
+  VisionMasks::Rows const &circle = VisionMasks::kCircles[_radius];
+  for (int y = 0; y < kSize; y++) { _visible[y] &= circle[y]; }
+}
+
+bool FieldOfView::isUpToDate(OccupancyGrid const &grid, Point origin, int radius) const {
+  return _valid && _origin.x == origin.x && _origin.y == origin.y && _radius == std::clamp(radius, 0, kMaxRadius) && _revision == grid.GetRevision();
+}
+
+bool FieldOfView::isVisible(Point point) const {
+  int x = point.x - _origin.x + kMaxRadius;
+  int y = point.y - _origin.y + kMaxRadius;
+  if (x < 0 || y < 0 || x >= kSize || y >= kSize) { return false; }
+  return VisionMasks::Test(_visible, x, y);
+}
+
+// recursive shadowcasting: walk the rows of the octant outward. a run of opaque tiles splits the visible sector: the part before the
+// run is scanned recursively from the next row on, the scan of the current row continues behind the run with a narrowed sector
+void FieldOfView::CastLight(TerrainMap const &terrain, OccupancyGrid const &grid, int row, double start, double end, int xx, int xy, int yx, int yy) {
+  if (start < end) { return; }
+  double newStart = 0.0;
+  for (int distance = row; distance <= _radius; distance++) {
+    bool blocked = false;
+    int dy = -distance;
+    for (int dx = -distance; dx <= 0; dx++) {
+      // slopes of the tile's left & right edges
+      double leftSlope = (dx - 0.5) / (dy + 0.5);
+      double rightSlope = (dx + 0.5) / (dy - 0.5);
+      if (start < rightSlope) { continue; }
+      if (end > leftSlope) { break; }
+
+      Point point{_origin.x + dx * xx + dy * xy, _origin.y + dx * yx + dy * yy};
+      SetVisible(point.x - _origin.x, point.y - _origin.y);
+      bool opaque = terrain.IsOpaque(point) || grid.IsBlocked(point, OccupancyGrid::kDoor);
+
+      if (blocked) {
+        if (opaque) {
+          newStart = rightSlope;
+          continue;
+        }
+        blocked = false;
+        start = newStart;
+      }
+      else if (opaque && distance < _radius) {
+        blocked = true;
+        CastLight(terrain, grid, distance + 1, start, leftSlope, xx, xy, yx, yy);
+        newStart = rightSlope;
+      }
+    }
+    if (blocked) { break; }
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef FIELD_OF_VIEW_H
+#define FIELD_OF_VIEW_H
+
+#include <cstdint>
+#include "point.h"
+#include "occupancy_grid.h"
+#include "terrain_map.h"
+#include "vision_mask.h"
+
+// the tiles the player can see: recursive shadowcasting over the terrain from the origin, up to the vision radius. opaque terrain
+// and closed doors cast shadows; the opaque tiles bordering the visible area are visible themselves (e.g. the walls of a room)
+// the result covers a window of kSize x kSize tiles around the origin, bit-packed like the vision masks (see VisionMasks). it is
+// only recomputed if the origin or the radius change, or if a door has been opened (i.e. the static layers of the occupancy grid
+// have changed)
+class FieldOfView {
+ public:
+  static int constexpr kMaxRadius = VisionMasks::kMaxRadius;
+  static int constexpr kSize = VisionMasks::kSize;
+
+  // recompute the visible tiles. radius is clamped to kMaxRadius
+  void Update(TerrainMap const &terrain, OccupancyGrid const &grid, Point origin, int radius);
+
+  // false if origin or radius have changed or a door has been opened since the last update
+  bool isUpToDate(OccupancyGrid const &grid, Point origin, int radius) const;
+
+  // visibility of a tile (map coordinates)
+  bool isVisible(Point point) const;
+  // visible tiles of a row of the window, one bit per tile. combine with VisionMask<radius> to tell the inside from the fringe
+  std::uint32_t GetRow(int y) const { return _visible[y]; }
+
+  // getters
+  Point GetOrigin() const { return _origin; }
+  int GetRadius() const { return _radius; }
+  unsigned int GetRevision() const { return _updates; }   // incremented on every update, e.g. to re-bake a vision mask
+
+ private:
+  // scan one octant row by row, starting at row. start & end are the slopes of the visible sector. xx, xy, yx, yy transform the
+  // octant's coordinates into map coordinates
+  void CastLight(TerrainMap const &terrain, OccupancyGrid const &grid, int row, double start, double end, int xx, int xy, int yx, int yy);
+  void SetVisible(int dx, int dy) { _visible[dy + kMaxRadius] |= std::uint32_t{1} << (dx + kMaxRadius); }
+
+  Point _origin{-1, -1};
+  int _radius{0};
+  unsigned int _revision{0};      // revision of the occupancy grid the field of view was computed for
+  unsigned int _updates{0};
+  bool _valid{false};
+  VisionMasks::Rows _visible{};
+};
+
+#endif
@@ -3,23 +3,21 @@
 
 #include "game.h"
 #include "game_utils.h"
-#include "SDL.h"
+#include "level_compiler.h"
 
 
 // -----------------
 // SETTING UP THE GAME
 // -----------------
 
-Game::Game(std::size_t grid_width, std::size_t grid_height) : _grid_max_x(grid_width), _grid_max_y(grid_height), engine(dev()), 
-      random_w(0, static_cast<int>(grid_width - 1)),random_h(0, static_cast<int>(grid_height - 1)) {
+Game::Game(std::uint64_t seed, MessageLog &messages) : _messages(messages), _seed(seed), _rng(seed, 0) {
   
   SetUpPlayer(10,37);  
-  SetUpGameMap("../src/levelmap.txt");
-  PlaceTreasure();
-  PlaceNPCs();
-  PlaceOpponents(); 
-  PlaceDoors();
-  PlaceEvents();
+  SetUpGameMap("levelmap.lvl", "../src/levelmap.txt", "../src/levelobjects.txt");
+  PlaceLevelObjects();
+  RegisterEntities();
+  UpdateFieldOfView();
+  UpdateLights();
   WelcomeMessage();
 }
 
@@ -27,44 +25,58 @@ Game::Game(std::size_t grid_width, std::size_t grid_height) : _grid_max_x(grid_w
 // GAME LOOP
 // ----------
 
-void Game::Run(Controller const &controller, Renderer &renderer, std::size_t target_frame_duration) {
-  Uint32 title_timestamp = SDL_GetTicks();
-  Uint32 frame_start;
-  Uint32 frame_end;
-  Uint32 frame_duration;
+// the simulation advances in fixed ticks of tick_duration (scaled by speed, see SimulationClock), decoupled from rendering. 
+// instead of waking up for every tick, the loop sleeps in Controller::WaitForInput until the next tick at which anything can happen 
+// (a combattant's turn, a timed effect, a forced redraw) or until input arrives. the ticks in between are caught up on wake-up
+void Game::Run(Controller &controller, Renderer &renderer, std::size_t tick_duration, int speed) {
+  SimulationClock clock(static_cast<std::uint32_t>(tick_duration), speed);
+  std::uint32_t title_timestamp = controller.GetTicks();
+  clock.Reset(title_timestamp);
   int frame_count = 0;
   bool running = true;
+  std::vector<Command> commands;
 
   while (running) {
-    frame_start = SDL_GetTicks();
-
-    // Input, Update, Render - the main game loop.
-    controller.HandleInput(running, _paused, _player);
-    if (!_paused && !_won && _player.alive) {
-      Update();
+    // replayed commands of the current tick (also while the game is paused or over)
+    ApplyReplayInput(running);
+
+    // Update: run all ticks that are due. no time passes for the simulation while the game is paused or over
+    if (isActive()) { clock.Advance(controller.GetTicks()); } 
+    else { clock.Reset(controller.GetTicks()); }
+    while (running && isActive() && clock.ConsumeTick()) { 
+      Update(); 
+      ApplyReplayInput(running);
     }
 
-    // with fog of war (WIP)
-    renderer.Render(_player, _treasure, _wall, _doors, _opponents, _npcs, _vicinitymap, _rendermap);
-    // without fog of war (bool = true if screen shall be cleared (default) - set to false if used on top of regular rendering)
-    //renderer.DebugRender(_player, _treasure, _wall, _doors, _opponents, _npcs, _events, true);
-
-    frame_end = SDL_GetTicks();
-
-    // Keep track of how long each loop through the input/update/render cycle takes.
-    frame_count++;
-    frame_duration = frame_end - frame_start;
+    // Render: most ticks don't change anything visible (entities only move on their turn), so only redraw on change
+    if (_redrawRequested || HasVisibleChanges()) {
+      // with fog of war (WIP)
+      renderer.Render(_player, _entities, _fov, _lights, _terrain, _messages);
+      // without fog of war, SdlRenderer only (bool = true if screen shall be cleared (default) - set to false if used on top of regular rendering)
+      //renderer.DebugRender(_player, _treasure, _terrain, _doors, _opponents, _npcs, _events, true);
+      MarkRendered();
+      frame_count++;
+    }
 
-    // After every second, update the window title.
-    if (frame_end - title_timestamp >= 1000) {
+    // After every second, update the window title and force a redraw.
+    std::uint32_t now = controller.GetTicks();
+    if (now - title_timestamp >= 1000) {
       renderer.UpdateWindowTitle(frame_count);
       frame_count = 0;
-      title_timestamp = frame_end;
+      title_timestamp = now;
+      _redrawRequested = true;
     }
 
-    // If the time for this frame is too small (i.e. frame_duration is smaller than the target ms_per_frame), delay the loop to achieve the correct frame rate.
-    if (frame_duration < target_frame_duration) {
-      SDL_Delay(target_frame_duration - frame_duration);
+    // Input: block until the next deadline or until an event arrives
+    std::uint32_t timeout = title_timestamp + 1000 - now;
+    if (isActive()) {
+      clock.Advance(now);
+      timeout = std::min(timeout, clock.GetTimeUntil(TicksUntilNextAction()));
+    }
+    commands.clear();
+    controller.WaitForInput(timeout, commands);
+    for (Command command : commands) {
+      if (!isReplaying() || command == Command::kQuit) { ApplyInput(command, running); }
     }
   }
 }
@@ -76,6 +88,7 @@ void Game::Run(Controller const &controller, Renderer &renderer, std::size_t tar
 
 void Game::Update() {  
   if (!_player.alive) return;
+  ++_tick;
   
   // check for timed effect triggers
   _player.UpdateEffects();
@@ -85,15 +98,13 @@ void Game::Update() {
   if (_player.direction != Player::Direction::kNone && _player.isMyTurnToMove()) {
     
     // calculate the position to which the player wants to move
-    SDL_Point requestedPosition = _player.tryMove();
+    Point requestedPosition = _player.tryMove();
     
-    // init path blocked and check for collisions:
-    _pathBlocked = DetectCollision(requestedPosition, _wall);
-
-    if (!IsOnMap(requestedPosition)) { _pathBlocked = true; };
+    // init path blocked and check for collisions (positions outside the map are blocked as well):
+    _pathBlocked = DetectCollision(requestedPosition, OccupancyGrid::kWall);
 
     {
-      Opponent* opponent = DetectCollision(requestedPosition, _opponents);
+      Opponent* opponent = DetectCollision(requestedPosition, _opponents, OccupancyGrid::kOpponent);
       if (opponent) {
         // kill player if collision with opponent occured        
         _pathBlocked = true;
@@ -101,8 +112,11 @@ void Game::Update() {
         if (!opponent->alive) {
           std::unique_ptr<InventoryItem> loot = opponent->DropLoot();
           if (loot) {
-            _treasure.emplace_back(std::make_unique<InteractiveE>(opponent->GetPosition().x, opponent->GetPosition().y, Entity::Type::kLoot, "You loot the body of your fallen opponent.\n"));
-            _treasure.back()->AddItem(std::move(loot));
+            std::unique_ptr<InteractiveE> body = std::make_unique<InteractiveE>(_entities, opponent->GetPosition().x, opponent->GetPosition().y, Entity::Type::kLoot, "You loot the body of your fallen opponent.\n");
+            body->AddItem(std::move(loot));
+            InteractiveE *item = body.get();
+            _obstaclemap.Register(item, OccupancyGrid::kTreasure, _treasure.Add(std::move(body)));
+            AddLootLight(*item);
           }
           _player.ReceiveXP(opponent->GetXPValue());
           opponent->MarkForErasure();
@@ -110,10 +124,16 @@ void Game::Update() {
       }    
     }
 
-    if (DetectCollisionAndInteract(&_player, requestedPosition, _treasure)) { _pathBlocked = true; }    
-    if (DetectCollisionAndInteract(&_player, requestedPosition, _npcs)) { _pathBlocked = true; }
-    if (DetectCollision(requestedPosition, _doors)) { 
-      Door* door = DetectCollision(requestedPosition, _doors);
+    // interact with treasure, NPCs & doors. chests, NPCs & doors block the path
+    if (InteractiveE* item = DetectCollision(requestedPosition, _treasure, OccupancyGrid::kTreasure | OccupancyGrid::kChest)) { 
+      item->Interact(&_player);
+      if (item->GetBlocksPath()) { _pathBlocked = true; }
+    }    
+    if (InteractiveE* npc = DetectCollision(requestedPosition, _npcs, OccupancyGrid::kNPC)) { 
+      npc->Interact(&_player);
+      if (npc->GetBlocksPath()) { _pathBlocked = true; }
+    }
+    if (Door* door = DetectCollision(requestedPosition, _doors, OccupancyGrid::kDoor)) { 
       door->Interact(&_player);
       _pathBlocked = true; 
     };
@@ -122,203 +142,198 @@ void Game::Update() {
     if (!_pathBlocked) {_player.SetPosition(requestedPosition);}
 
     // check for events at the new position
-    TriggerMapEvents(&_player, _events);
+    TriggerMapEvents(&_player);
   }
 
+  // the player may have moved, opened a door or changed the vision
+  UpdateFieldOfView();
+  UpdateLights();
+
   // UPDATE OPPONENTS
-  // only try to move if it's the opponents turn to avoid unnecessary checkCollision loops.
-  for (std::unique_ptr<Opponent> &opponent : _opponents) {
-
-    if (opponent->isMyTurnToMove()) {
-      // calculate the position to which the opponent wants to move 
-      SDL_Point requestedPosition = opponent->tryMove(GameUtils::MoveTowardTarget(GetMapOfObstacles(), opponent->GetPosition(), _player.GetPosition(), 20), _player.GetPosition());
-      //SDL_Point requestedPosition = opponent->tryMove();
-        
-      // init path blocked and check for collisions: 
-      _pathBlocked = DetectCollision(requestedPosition, _wall);
-  
-      if (!IsOnMap(requestedPosition)) { _pathBlocked = true; };
-        if (DetectCollision(requestedPosition, _opponents)) { _pathBlocked = true; };
-        if (DetectCollision(requestedPosition, _doors)) { _pathBlocked = true; };
- 
-        if (DetectCollision(requestedPosition, &_player)) {
-          // kill player if collision with opponent occured
-          if (opponent->isMyTurnToAttack()) { HandleFight(opponent.get(), &_player); }
-          _pathBlocked = true;
-        }    
-        if (DetectCollision(requestedPosition, _treasure)) { _pathBlocked = true; } 
-        if (DetectCollision(requestedPosition, _npcs)) { _pathBlocked = true; }
-
-        // update position if movement is not blocked by obstacle
-        if (!_pathBlocked) {opponent->SetPosition(requestedPosition);}     
-    } 
+  // only the opponents whose turn it is are touched, see TurnScheduler
+  TurnScheduler::Turn turn;
+  while (_turns.PopDue(_tick, turn)) {
+    Opponent *opponent = _opponents.Get(turn.handle);
+    if (!opponent) { continue; }    // erased since its turn has been scheduled
+    _turns.Reschedule(turn, _tick + opponent->GetMoveInterval());
+
+    // calculate the position to which the opponent wants to move 
+    // distances to the player are only recomputed if the player has moved or obstacles have changed
+    if (!_distancemap.isUpToDate(_obstaclemap, _player.GetPosition())) { _distancemap.Update(_obstaclemap, _player.GetPosition()); }
+    Point requestedPosition = opponent->tryMove(_distancemap.NextStep(opponent->GetPosition()), _player.GetPosition(), _fov.isVisible(opponent->GetPosition()));
+      
+    // init path blocked and check for collisions with walls, doors, NPCs, chests and other opponents:
+    _pathBlocked = DetectCollision(requestedPosition, OccupancyGrid::kBlocking);
+
+    if (DetectCollision(requestedPosition, OccupancyGrid::kPlayer)) {
+      // kill player if collision with opponent occured
+      if (opponent->isMyTurnToAttack(_tick)) { HandleFight(opponent, &_player); }
+      _pathBlocked = true;
+    }    
+
+    // update position if movement is not blocked by obstacle
+    if (!_pathBlocked) {opponent->SetPosition(requestedPosition);}     
   }   
 
   // "Game Over" message  
   if (!_player.alive) { 
-    std::cout << "GAME OVER: You were killed!" << std::endl;
-    std::cout << "---------------" << std::endl; 
+    Messages() << "GAME OVER: You were killed!" << std::endl;
+    Messages() << "---------------" << std::endl; 
   }
   if (_player.GetQuestComplete()) { 
     _won = true;
-    std::cout << "---------------" << std::endl; 
-    std::cout << "YOU WON!" << std::endl;
-    std::cout << "---------------" << std::endl; 
+    Messages() << "---------------" << std::endl; 
+    Messages() << "YOU WON!" << std::endl;
+    Messages() << "---------------" << std::endl; 
   }
   
   CleanUpErasedEntities();
+
+  if (_recording || _replay) { UpdateHashChain(); }
 }
 
 
-// --------------------------------------------------------------------------------------------------------
-// VARIOUS COLLISION DETECTION METHODS - SOME OF WHICH COULD BE MADE OBSOLETE IF _OBSTACLEMAP IS BEING USED
-// --------------------------------------------------------------------------------------------------------
+// ------------
+// INPUT
+// ------------
 
-// Collision Detection #1: Collision between Point and Entity (e.g. for collisions between opponent and player)
-bool Game::DetectCollision(SDL_Point point, Entity *entity) {
-  if (entity != nullptr) {
-    return (point.x == entity->GetPosition().x && point.y == entity->GetPosition().y);
-  }
-  return false;
-}
+// apply a command of the controller or of a replayed log. every applied command is recorded with the current tick
+void Game::ApplyInput(Command command, bool &running) {
+  if (_recording) { _recording->Add(_tick, command); }
 
-// Collision Detection #2: Collision between Point and Vector of Entities (via unique ptr). Used to check if movement to Point is valid e.g. for movement or for initial placement of objects
-bool Game::DetectCollision(SDL_Point point, std::vector<std::unique_ptr<Entity>> &entities) {
-  if (!entities.empty()) {
-    auto it = std::find_if(entities.begin(), entities.end(), [&point](const std::unique_ptr<Entity>& item){return point.x == item->GetPosition().x && point.y == item->GetPosition().y;});
-    if (it != entities.end()) { return true; }  
-  }  
-  return false;
+  switch (command) {
+    // game control
+    case Command::kQuit: 
+      running = false; 
+      break;
+    case Command::kPause: {
+      std::string s = _paused == false ? "Pause" : "Resume";
+      Messages() << "---------------" << std::endl; 
+      Messages() << s << " game" << std::endl;
+      _paused = !_paused;
+      break;
+    }
+    // movement
+    case Command::kUp: if (!_paused) { _player.direction = Player::Direction::kUp; } break;
+    case Command::kDown: if (!_paused) { _player.direction = Player::Direction::kDown; } break;
+    case Command::kLeft: if (!_paused) { _player.direction = Player::Direction::kLeft; } break;
+    case Command::kRight: if (!_paused) { _player.direction = Player::Direction::kRight; } break;
+    // misc controls
+    case Command::kStatus: _player.DisplayStatus(); break;
+    case Command::kInventory: _player.DisplayInventory(); break;
+    default: 
+      // equip or use inventory item
+      _player.SelectItem(static_cast<int>(command) - static_cast<int>(Command::kSelectItem1) + 1);
+      break;
+  }
 }
 
-// Collision Detection #3: Collision with Interactive Entities without invoking interaction method
-bool Game::DetectCollision(SDL_Point point, std::vector<std::unique_ptr<InteractiveE>> &entities) {
-  if (!entities.empty()) {
-    auto it = std::find_if(entities.begin(), entities.end(), [&point](const std::unique_ptr<InteractiveE>& item){return point.x == item->GetPosition().x && point.y == item->GetPosition().y;});
-    if (it != entities.end()) {      
-      if ((*it)->GetBlocksPath()) { return true; }
-    }
+// apply all replayed commands which were applied after the current tick in the recorded session
+void Game::ApplyReplayInput(bool &running) {
+  while (running && isReplaying() && _replay->GetEntries()[_replayPos].tick <= _tick) { 
+    ApplyInput(_replay->GetEntries()[_replayPos++].command, running); 
   }
-  return false;
 }
 
-// Collision Detection #4: Collision between Point and Vector of Opponents (via unique ptr). Used e.g. to get the opponent handle if the player attacks.
-Opponent* Game::DetectCollision(SDL_Point point, std::vector<std::unique_ptr<Opponent>> &opponents) {
-  if (!opponents.empty()) {
-    auto it = std::find_if(opponents.begin(), opponents.end(), [&point](const std::unique_ptr<Opponent>& item){return point.x == item->GetPosition().x && point.y == item->GetPosition().y;});
-    if (it != opponents.end()) { return (*it).get(); }  
-  }  
-  return nullptr;
+void Game::StartRecording(InputLog &log) {
+  _recording = &log;
+  _recording->SetSeed(_seed);
 }
 
-// Collision Detection #5: Collision with doors
-Door* Game::DetectCollision(SDL_Point point, std::vector<std::unique_ptr<Door>> &doors) {
-  if (!doors.empty()) {
-    auto it = std::find_if(doors.begin(), doors.end(), [&point](const std::unique_ptr<Door>& item){
-      return (point.x == item->GetAnchorPosition().x && point.y == item->GetAnchorPosition().y) ||(point.x == item->GetWingPosition().x && point.y == item->GetWingPosition().y);
-     });
-    if (it != doors.end()) { return (*it).get(); }  
-  }  
-  return nullptr;
+void Game::StartReplay(InputLog const &log) {
+  if (log.GetSeed() != _seed) { std::cerr << "Warning: The replayed session has been recorded with a different seed (" << log.GetSeed() << ")" << std::endl; }
+  _replay = &log;
+  _replayPos = 0;
 }
 
-// Collision Detection #6: Collision between Player and Interactive Entities - calls InteractiveE::Interact() method upon collision
-bool Game::DetectCollisionAndInteract(Player *player, SDL_Point point, std::vector<std::unique_ptr<InteractiveE>> &entities) {
-  if (!entities.empty()) {
-    auto it = std::find_if(entities.begin(), entities.end(), [&point](const std::unique_ptr<InteractiveE>& item){return point.x == item->GetPosition().x && point.y == item->GetPosition().y;});
-    if (it != entities.end()) {      
-      (*it)->Interact(player);
-      if ((*it)->GetBlocksPath()) { return true; }
+// chain the world state of the current tick into the hash chain. every kHashInterval ticks, the chain is recorded resp. compared 
+// to the replayed log. as the chain covers every tick, a divergence is detected at the next checkpoint
+void Game::UpdateHashChain() {
+  _hashChain = (_hashChain ^ HashWorldState()) * 0x100000001b3ULL;
+  if (_tick % InputLog::kHashInterval != 0) { return; }
+  if (_recording) { _recording->AddHash(_hashChain); }
+  if (_replay && _divergedAt == 0) {
+    std::size_t checkpoint = _tick / InputLog::kHashInterval - 1;
+    if (checkpoint < _replay->GetHashes().size() && _replay->GetHashes()[checkpoint] != _hashChain) {
+      _divergedAt = _tick;
+      std::cerr << "Warning: Replay diverged from the recorded session between tick " << _tick - InputLog::kHashInterval << " and " << _tick << std::endl;
     }
   }
-  return false;
 }
 
-// basically another collision method
-void Game::TriggerMapEvents(Player *player, std::vector<std::unique_ptr<MapEvent>> &events) {
-  for (std::unique_ptr<MapEvent> &event : events) {
-    if (event->isInArea(player->GetPosition().x, player->GetPosition().y)) { event->Interact(player); }
+// FNV-1a over everything that defines the state of the simulation: tick, entities, player & opponent stats
+std::uint64_t Game::HashWorldState() const {
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  auto mix = [&hash](std::uint64_t value) { 
+    for (int i = 0; i < 8; i++) { hash = (hash ^ ((value >> (8 * i)) & 0xFF)) * 0x100000001b3ULL; }
+  };
+  mix(_tick);
+  for (int slot = 0; slot < _entities.GetSize(); slot++) {
+    if (!_entities.isLive(slot)) { continue; }
+    Point position = _entities.GetPosition(slot);
+    mix(static_cast<std::uint64_t>(slot) << 32 | static_cast<std::uint32_t>(position.x));
+    mix(static_cast<std::uint64_t>(_entities.GetType(slot)) << 40 | static_cast<std::uint64_t>(_entities.GetVariant(slot)) << 32 | static_cast<std::uint32_t>(position.y));
   }
+  mix(static_cast<std::uint32_t>(_player.GetHP()));
+  mix(static_cast<std::uint32_t>(_player.GetTotalXP()));
+  for (std::unique_ptr<Opponent> const &opponent : _opponents) { mix(static_cast<std::uint32_t>(opponent->GetHP())); }
+  return hash;
 }
 
 
-// -------------------
-// GAME WORLD CONTROL
-// -------------------
+// ------------
+// MAP EVENTS
+// ------------
 
-// get a representation of the game map where each element is either "kNone" or "kObstacle"
-// used as input for calculating the opponent's movement
-// CAN BE MADE OBSOLETE IF _OBSTACLEMAP IS BEING USED
-std::vector<std::vector<Entity::Type>> Game::GetMapOfObstacles () {
-  std::vector<std::vector<Entity::Type>> grid {};
-  std::vector<Entity::Type> row {};
-  
-  // init emtpy grid (of format grid[y][x])
-  for (int y = 0; y < _grid_max_y; y++) {
-    row.clear();
-    for (int x = 0; x < _grid_max_x; x++) {
-      row.push_back(Entity::Type::kNone);
-    }
-    grid.push_back(row);
-  }  
+// basically another collision method: look up the events covering the player's position in the trigger map
+void Game::TriggerMapEvents(Player *player) {
+  // copy the list of the tile first, since interacting may change the area of an event (e.g. collection quests)
+  _triggered = _eventtriggers.GetEvents(player->GetPosition());
+  for (MapEvent *event : _triggered) { event->Interact(player); }
+}
 
-  // add obstacles to grid
-  for (std::unique_ptr<Entity> &brick : _wall) {
-    grid[brick->GetPosition().y][brick->GetPosition().x] = Entity::Type::kObstacle;    
-  }
-  for (std::unique_ptr<InteractiveE> &npc : _npcs) {
-    grid[npc->GetPosition().y][npc->GetPosition().x] = Entity::Type::kObstacle;    
-  }
-  for (std::unique_ptr<Door> &door : _doors) {
-    grid[door->GetAnchorPosition().y][door->GetAnchorPosition().x] = Entity::Type::kObstacle;
-    grid[door->GetWingPosition().y][door->GetWingPosition().x] = Entity::Type::kObstacle;
+// the field of view is only recomputed if the player has moved, a door has been opened or the vision radius has changed
+void Game::UpdateFieldOfView() {
+  int radius = _player.GetVisionRadius();
+  if (!_fov.isUpToDate(_obstaclemap, _player.GetPosition(), radius)) { _fov.Update(_terrain, _obstaclemap, _player.GetPosition(), radius); }
+}
+
+// the player's torch is the only light which can move or change, so it is the only one set on every update. the light map only 
+// recomputes the tiles around the lights which have changed. the torch lights up the surroundings until it burns low (see Player::GetVisionMod)
+void Game::UpdateLights() {
+  if (_player.GetVisionMod() == 2) { _lights.SetLight(_player.GetSlot(), _player.GetPosition(), 6, 0xCC); }
+  else if (_player.GetVisionMod() == 1) { _lights.SetLight(_player.GetSlot(), _player.GetPosition(), 4, 0x88); }
+  else { _lights.RemoveLight(_player.GetSlot()); }
+  _lights.Update(_terrain, _obstaclemap);
+}
+
+// loot glows faintly, so the bodies of fallen opponents can be found in the dark. the light is added when the loot is placed and
+// removed when it is erased (see CleanUpErasedEntities)
+void Game::AddLootLight(InteractiveE &loot) {
+  _lights.SetLight(loot.GetSlot(), loot.GetPosition(), 2, 0x55);
+}
+
+// ambient light of the vision levels, matching the brightness the player's vision had before the light map
+std::uint8_t Game::GetAmbientLevel(Player::Vision vision) {
+  switch (vision) {
+    case Player::Vision::kCavern: return 0xAA;
+    case Player::Vision::kDark1: return 0x66;
+    case Player::Vision::kDark2: return 0x33;
+    case Player::Vision::kDark3: return 0x11;
+    default: return LightMap::kDaylight;
   }
-  return grid;
 }
 
 
+// -------------------
+// GAME WORLD CONTROL
+// -------------------
+
+// erased objects are removed in one batch per registry at the end of each frame
 void Game::CleanUpErasedEntities() {    
-  // the following should eventually be done with a template function.
-  // check wall (necessary for door placement)
-  while (true) {
-    auto it = std::find_if(_wall.begin(), _wall.end(), [](const std::unique_ptr<Entity>& item){return item->isMarkedForErasure();});
-    if (it == _wall.end()) {       
-      break;
-    }
-    else {
-      _wall.erase(it);
-    }
-  }
-  // check opponent
-  while (true) {
-   auto it = std::find_if(_opponents.begin(), _opponents.end(), [](const std::unique_ptr<Opponent>& item){return item->isMarkedForErasure();});
-   if (it == _opponents.end()) {       
-     break;
-   }
-   else {
-    _opponents.erase(it);
-   }
-  }
-  // check treasure
-  while (true) {
-    auto it = std::find_if(_treasure.begin(), _treasure.end(), [](const std::unique_ptr<InteractiveE>& item){return item->isMarkedForErasure();});
-    if (it == _treasure.end()) {       
-      break;
-    }
-    else {
-      _treasure.erase(it);
-    }
-  }
-  // check events
-  while (true) {
-    auto it = std::find_if(_events.begin(), _events.end(), [](const std::unique_ptr<MapEvent>& item){return item->isMarkedForErasure();});
-    if (it == _events.end()) {       
-      break;
-    }
-    else {
-      _events.erase(it);
-    }
-  }
+  _opponents.EraseMarked();
+  _treasure.EraseMarked([this](InteractiveE &item) { _lights.RemoveLight(item.GetSlot()); });
+  _events.EraseMarked();
   // currently no erasable NPCs yet
 }
 
@@ -328,24 +343,25 @@ void Game::CleanUpErasedEntities() {
 
 // deal damage to defender
 void Game::HandleFight (Combattant* attacker, Combattant* defender) {
-  std::cout << "---------------" << std::endl; 
+  Messages() << "---------------" << std::endl; 
 
   // who attacks' who?
   if ( attacker == &_player ) { 
-    std::cout << "You attack " << defender->GetName(); 
+    Messages() << "You attack " << defender->GetName(); 
   } else if ( defender == &_player ) {
-    std::cout << attacker->GetName() << " attacks you"; 
+    Messages() << attacker->GetName() << " attacks you"; 
   } else {
-    std::cout << attacker->GetName() << " attacks " << defender->GetName();
+    Messages() << attacker->GetName() << " attacks " << defender->GetName();
   }
 
   // get damage
-  int damage = (rand() % attacker->GetAttackValue()) - (rand() % defender->GetDefenseValue());
+  int damage = _rng.Roll(attacker->GetAttackValue());
+  damage -= _rng.Roll(defender->GetDefenseValue());
 
   // if nobody got hurt 
   if (damage <= 0) { 
-    if ( attacker == &_player ) { std::cout << " and miss." << std::endl; }
-    else { std::cout << " and misses." << std::endl; }      
+    if ( attacker == &_player ) { Messages() << " and miss." << std::endl; }
+    else { Messages() << " and misses." << std::endl; }      
   } 
   else {
     // deal damage
@@ -353,19 +369,19 @@ void Game::HandleFight (Combattant* attacker, Combattant* defender) {
 
     // print status message       
     if ( defender == &_player ) {
-      std::cout << " and hits you for " << damage << " points of damage."<< std::endl; 
-      std::cout << "Hit points remaining: (" << defender->GetHP() << "/" << defender->GetMaxHP() << ")" << std::endl;
+      Messages() << " and hits you for " << damage << " points of damage."<< std::endl; 
+      Messages() << "Hit points remaining: (" << defender->GetHP() << "/" << defender->GetMaxHP() << ")" << std::endl;
     }          
     else { 
         std::string s = ( attacker == &_player ) ? "" : "s";
-        std::cout << " and hit" << s << " for " << damage << " points of damage." << std::endl; //
+        Messages() << " and hit" << s << " for " << damage << " points of damage." << std::endl; //
   
         float health = static_cast<float>(defender->GetHP()) / static_cast<float>(defender->GetMaxHP());
-        if (health >= 0.8) {std::cout << defender->GetName() << " is bruised." << std::endl; } 
-        else if (health <= 0.0 ) {std::cout << defender->GetName() << " is dead." << std::endl; }   
-        else if (health <= 0.15) {std::cout << defender->GetName() << " is nearly dead." << std::endl; }          
-        else if (health <= 0.3 ) {std::cout << defender->GetName() << " is heavily wounded." << std::endl; }
-        else if (health <= 0.5) {std::cout << defender->GetName() << " is wounded." << std::endl; }
+        if (health >= 0.8) {Messages() << defender->GetName() << " is bruised." << std::endl; } 
+        else if (health <= 0.0 ) {Messages() << defender->GetName() << " is dead." << std::endl; }   
+        else if (health <= 0.15) {Messages() << defender->GetName() << " is nearly dead." << std::endl; }          
+        else if (health <= 0.3 ) {Messages() << defender->GetName() << " is heavily wounded." << std::endl; }
+        else if (health <= 0.5) {Messages() << defender->GetName() << " is wounded." << std::endl; }
     }
   }
 }
@@ -375,36 +391,54 @@ void Game::HandleFight (Combattant* attacker, Combattant* defender) {
 // HELPER FUNCTIONS
 // -----------------
 
-// check if a position is on the game map
-bool Game::IsOnMap(SDL_Point point) {  
-  if ( point.x < 0 ) { return false; }
-  if ( point.y < 0 ) { return false; }
-  if ( point.x >= _grid_max_x ) { return false; }
-  if ( point.y >= _grid_max_y ) { return false; }
-  return true;
+// number of ticks until the next tick at which something can happen: the player's move (if a move has been requested), 
+// an opponent's turn or a timed effect. at least 1, since the loop calls this after all due ticks have been run
+int Game::TicksUntilNextAction() const {
+  int ticks = _player.TicksUntilNextEffect();
+  if (_player.direction != Player::Direction::kNone) { ticks = std::min(ticks, _player.TicksUntilMyTurnToMove()); }
+  if (_turns.GetNextTick() != TurnScheduler::kNever) { ticks = std::min<std::uint64_t>(ticks, _turns.GetNextTick() - _tick); }
+  // the next replayed command is applied right after the tick it was recorded at
+  if (isReplaying()) { ticks = std::min<std::uint64_t>(ticks, _replay->GetEntries()[_replayPos].tick - _tick); }
+  return std::max(ticks, 1);
+}
+
+// true if anything that is drawn has changed since the last rendered frame: entities (incl. the player) moved, appeared, vanished or changed 
+// their appearance (e.g. opened doors), the player's vision or the light levels changed (illumination events, torches) or the player died
+bool Game::HasVisibleChanges() {
+  return _entities.GetRevision() != _renderedRevision || _player.GetVision() != _renderedVision || _player.alive != _renderedAlive ||
+         _lights.GetRevision() != _renderedLights || _messages.GetLineCount() != _renderedMessages;
+}
+
+void Game::MarkRendered() {
+  _renderedRevision = _entities.GetRevision();
+  _renderedVision = _player.GetVision();
+  _renderedLights = _lights.GetRevision();
+  _renderedAlive = _player.alive;
+  _renderedMessages = _messages.GetLineCount();
+  _redrawRequested = false;
 }
 
 void Game::WelcomeMessage() {
-  std::cout << std::endl << "-----------------------------------------------------" << std::endl;
-  std::cout << "DUNGEONS OF ELLESMERE - QUEST FOR THE GOLDEN McGUFFIN" << std::endl;
-  std::cout << "-----------------------------------------------------" << std::endl << std::endl;
-  std::cout << "Welcome to Dungeons of Ellesmere, a proof-of-concept RPG written in C++ using the SDL-Library." << std::endl;
-  std::cout << "You'll play the role of a generic adventurer searching for the legendary McGuffin of King Lazyplot." << std::endl << std::endl;
-  std::cout << "Use the arrow keys to move the adventurer (blue square) across the map." << std::endl;
-  std::cout << "Move on in-game objects to interact with them. You can:" << std::endl;
-  std::cout << "- talk to friendly NPCs (light blue squares)" << std::endl;
-  std::cout << "- collect treasure (yellow squares)" << std::endl;
-  std::cout << "- open treasure chests (brown squares)" << std::endl;
-  std::cout << "- fight opponents (red squares)" << std::endl << std::endl;
-  std::cout << "In order to fight an opponent, you have to repeatedly move toward it using the arrow keys. Each key press equals one strike." << std::endl << std::endl;
-  std::cout << "Status information and dialogue is printed on the console, so make sure to keep an eye on the text output as well as the game map!" << std::endl << std::endl;
-  std::cout << "Game control:" << std::endl;
-  std::cout << "At any time during the game, you can:" << std::endl;
-  std::cout << "Press (p) for pausing / unpausing the game" << std::endl;
-  std::cout << "Press (i) to take a look at your inventory" << std::endl;
-  std::cout << "Press (c) to check your adventurer's health" << std::endl;
-  std::cout << "Press (1-9) to use or equip items from your inventory" << std::endl << std::endl;
-  std::cout << "Now have fun and save the world!" << std::endl;
+  Messages() << std::endl << "-----------------------------------------------------" << std::endl;
+  Messages() << "DUNGEONS OF ELLESMERE - QUEST FOR THE GOLDEN McGUFFIN" << std::endl;
+  Messages() << "-----------------------------------------------------" << std::endl << std::endl;
+  Messages() << "Welcome to Dungeons of Ellesmere, a proof-of-concept RPG written in C++ using the SDL-Library." << std::endl;
+  Messages() << "You'll play the role of a generic adventurer searching for the legendary McGuffin of King Lazyplot." << std::endl << std::endl;
+  Messages() << "Use the arrow keys to move the adventurer (blue square) across the map." << std::endl;
+  Messages() << "Move on in-game objects to interact with them. You can:" << std::endl;
+  Messages() << "- talk to friendly NPCs (light blue squares)" << std::endl;
+  Messages() << "- collect treasure (yellow squares)" << std::endl;
+  Messages() << "- open treasure chests (brown squares)" << std::endl;
+  Messages() << "- fight opponents (red squares)" << std::endl << std::endl;
+  Messages() << "In order to fight an opponent, you have to repeatedly move toward it using the arrow keys. Each key press equals one strike." << std::endl << std::endl;
+  Messages() << "Status information and dialogue is shown below the map, so make sure to keep an eye on the messages as well as the game map!" << std::endl << std::endl;
+  Messages() << "Game control:" << std::endl;
+  Messages() << "At any time during the game, you can:" << std::endl;
+  Messages() << "Press (p) for pausing / unpausing the game" << std::endl;
+  Messages() << "Press (i) to take a look at your inventory" << std::endl;
+  Messages() << "Press (c) to check your adventurer's health" << std::endl;
+  Messages() << "Press (1-9) to use or equip items from your inventory" << std::endl << std::endl;
+  Messages() << "Now have fun and save the world!" << std::endl;
 }
 
 
@@ -414,22 +448,124 @@ void Game::WelcomeMessage() {
 // ----------------------------------------------------------------------------
 
 
-// read game map from file
-void Game::SetUpGameMap(std::string filepath) {
+// read game map & level objects from the compiled level file. if the level has not been compiled, compile the text files in memory instead
+void Game::SetUpGameMap(std::string levelpath, std::string mappath, std::string objectpath) {
  
-    // read game map from file & store tile type information for rendering
-    _rendermap = GameUtils::GetRenderBaseMap(filepath);
-    
-    // init the (hardcoded) vicinity map (for rendering)
-    _vicinitymap = GameUtils::GetVicinityMap();
+    // map compiled level & use its tile type information for rendering and collision detection in place
+    if (!_levelfile.Open(levelpath)) {
+      std::cerr << "Level file '" << levelpath << "' not found, reading text files instead (run levelc to compile them)" << std::endl;
+      std::vector<std::uint8_t> image;
+      if (!LevelCompiler::Compile(GameUtils::GetTerrainMap(mappath), objectpath, image) || !_levelfile.Open(std::move(image))) {
+        std::cerr << "Error: Level could not be loaded!" << std::endl;
+      }
+    }
+    if (_levelfile.isOpen()) {
+      LevelFormat::Header const &header = _levelfile.GetHeader();
+      _terrain.Attach(header.width, header.height, _levelfile.GetTiles());
+    }
     
-    // init walls for collision detection - can eventually be replaced by _obstaclemap
-    _wall = GameUtils::GetWallFromMap(_rendermap);
-    _obstaclemap = GameUtils::InitObstacleMap(_rendermap); // currently not used yet - also, GameUtils::InitObstacleMap still WIP
+    // init the obstacle map for collision detection & path finding (impassable terrain is marked as wall)
+    _obstaclemap.Init(_terrain);
+    _eventtriggers.Init(_terrain.GetWidth(), _terrain.GetHeight());
     
 }
 
-// eventually all the methods below should be read from file to allow for different game maps/dungeon levels
+// place treasure, NPCs, doors, opponents & events in a single pass over the tables of the level file
+void Game::PlaceLevelObjects() {
+  if (!_levelfile.isOpen()) { return; }
+  LevelFormat::Header const &header = _levelfile.GetHeader();
+  LevelFormat::EntityRecord const *entities = _levelfile.GetTable<LevelFormat::EntityRecord>(header.entities);
+  LevelFormat::ItemRecord const *items = _levelfile.GetTable<LevelFormat::ItemRecord>(header.items);
+  LevelFormat::EventRecord const *events = _levelfile.GetTable<LevelFormat::EventRecord>(header.events);
+  LevelFormat::AreaRecord const *area = _levelfile.GetTable<LevelFormat::AreaRecord>(header.area);
+
+  // count objects first, so that each container is allocated only once
+  std::size_t counts[static_cast<std::size_t>(LevelFormat::EntityKind::kDoor) + 1]{};
+  for (std::uint32_t i = 0; i < header.entities.count; i++) { counts[static_cast<std::size_t>(entities[i].kind)]++; }
+  _treasure.reserve(counts[static_cast<std::size_t>(LevelFormat::EntityKind::kTreasure)] + counts[static_cast<std::size_t>(LevelFormat::EntityKind::kChest)] +
+                    counts[static_cast<std::size_t>(LevelFormat::EntityKind::kLoot)]);
+  _opponents.reserve(counts[static_cast<std::size_t>(LevelFormat::EntityKind::kOpponent)]);
+  _npcs.reserve(counts[static_cast<std::size_t>(LevelFormat::EntityKind::kNPC)]);
+  _doors.reserve(counts[static_cast<std::size_t>(LevelFormat::EntityKind::kDoor)]);
+  _events.reserve(header.events.count);
+  // doors consist of two entities
+  _entities.Reserve(_entities.GetSize() + header.entities.count + counts[static_cast<std::size_t>(LevelFormat::EntityKind::kDoor)] + header.events.count);
+
+  for (std::uint32_t i = 0; i < header.entities.count; i++) {
+    LevelFormat::EntityRecord const &record = entities[i];
+    switch (record.kind) {
+      case LevelFormat::EntityKind::kTreasure:
+      case LevelFormat::EntityKind::kChest:
+      case LevelFormat::EntityKind::kLoot: {
+        Entity::Type type = record.kind == LevelFormat::EntityKind::kChest ? Entity::Type::kChest : 
+                            record.kind == LevelFormat::EntityKind::kLoot ? Entity::Type::kLoot : Entity::Type::kTreasure;
+        std::unique_ptr<InteractiveE> treasure = std::make_unique<InteractiveE>(_entities, record.x, record.y, type, _levelfile.GetString(record.text));
+        for (std::uint32_t j = record.firstItem; j < record.firstItem + record.itemCount; j++) {
+          std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
+          item->name = _levelfile.GetString(items[j].name);
+          item->number = items[j].number;
+          item->attack_mod = items[j].attack_mod;
+          item->defense_mod = items[j].defense_mod;
+          item->healing = items[j].healing;
+          item->isSingleUseItem = (items[j].flags & LevelFormat::kSingleUse) != 0;
+          item->isWeapon = (items[j].flags & LevelFormat::kWeapon) != 0;
+          item->isArmor = (items[j].flags & LevelFormat::kArmor) != 0;
+          item->isKey = (items[j].flags & LevelFormat::kKey) != 0;
+          item->isMcGuffin = (items[j].flags & LevelFormat::kMcGuffin) != 0;
+          treasure->AddItem(std::move(item));
+        }
+        _treasure.Add(std::move(treasure));
+        break;
+      }
+      case LevelFormat::EntityKind::kOpponent: {
+        std::unique_ptr<Opponent> opponent = std::make_unique<Opponent>(_entities, record.x, record.y, Entity::Type::kOpponent, record.maxHP, record.attack, record.defense, 
+                                                                        record.agility, record.xp, _levelfile.GetString(record.text));
+        // stream by index in the level file, so an opponent's rolls don't depend on the other opponents
+        opponent->SetRandomStream(Pcg32(_seed, 1 + i));
+        _opponents.Add(std::move(opponent));
+        break;
+      }
+      case LevelFormat::EntityKind::kNPC:
+      {
+        std::unique_ptr<InteractiveE> npc = std::make_unique<InteractiveE>(_entities, record.x, record.y, _levelfile.GetString(record.text));
+        if (record.flags & LevelFormat::kMainQuestGiver) { npc->SetAsMainQuestGiver(); }
+        _npcs.Add(std::move(npc));
+        break;
+      }
+      case LevelFormat::EntityKind::kDoor:
+        _doors.Add(std::make_unique<Door>(_entities, record.x, record.y, (record.flags & LevelFormat::kHorizontal) != 0, (record.flags & LevelFormat::kSecret) != 0, (record.flags & LevelFormat::kLocked) != 0));
+        break;
+    }
+  }
+
+  // the tiles of the illumination events seed the ambient zones of the light map
+  std::vector<LightMap::Zone> zones;
+  for (std::uint32_t i = 0; i < header.events.count; i++) {
+    LevelFormat::EventRecord const &record = events[i];
+    MapEvent::EventType type = static_cast<MapEvent::EventType>(record.type);
+    std::unique_ptr<MapEvent> event;
+    if (type == MapEvent::EventType::kIllumination) {
+      event = std::make_unique<MapEvent>(_entities, record.x, record.y, static_cast<Player::Vision>(record.vision), _levelfile.GetString(record.msg));
+    }
+    else {
+      event = std::make_unique<MapEvent>(_entities, record.x, record.y, type, _levelfile.GetString(record.msg), record.xp, record.dmg);
+    }
+    for (std::uint32_t j = record.firstTile; j < record.firstTile + record.tileCount; j++) {
+      event->AddToArea(area[j].x, area[j].y);
+    }
+    if (type == MapEvent::EventType::kIllumination) {
+      std::uint8_t level = GetAmbientLevel(static_cast<Player::Vision>(record.vision));
+      for (Point point : event->GetArea()) { zones.push_back({point, level}); }
+    }
+    _events.Add(std::move(event));
+  }
+  _lights.Init(_terrain, zones);
+  for (std::unique_ptr<InteractiveE> &item : _treasure) {
+    if (item->GetType() == Entity::Type::kLoot) { AddLootLight(*item); }
+  }
+}
+
+// the player is not part of the level file, since it is carried over between levels
 void Game::SetUpPlayer(int x, int y) {  
   _player.SetPosition({x,y});
   // SET UP PLAYER INVENTORY
@@ -460,208 +596,26 @@ void Game::SetUpPlayer(int x, int y) {
 }
  
   
-void Game::PlaceNPCs() {
-  _npcs.emplace_back(std::make_unique<InteractiveE>(12, 35, "../src/dialogue.txt"));
-  _npcs.at(0)->SetAsMainQuestGiver();
-}
-
-void Game::PlaceDoors() {  
-  _doors.emplace_back(std::make_unique<Door>(11, 17, true, false, true));  
-  _doors.emplace_back(std::make_unique<Door>(30, 5, true, true, false));
-  
-}
-
-void Game::PlaceOpponents() {
-
-  //_opponents.emplace_back(std::make_unique<Opponent>(5, 8, Entity::Type::kNPC));
-  _opponents.emplace_back(std::make_unique<Opponent>(7, 4, Entity::Type::kNPC));
-  _opponents.emplace_back(std::make_unique<Opponent>(11, 8, Entity::Type::kNPC));
-  _opponents.emplace_back(std::make_unique<Opponent>(14, 6, Entity::Type::kNPC));
-  _opponents.emplace_back(std::make_unique<Opponent>(29, 21, Entity::Type::kNPC));
-}
-
-
-void Game::PlaceEvents() {
-  // enter cave
-  _events.emplace_back(std::make_unique<MapEvent>(8, 31, "It is dark in here. The air inside smells like mold."));
-  _events.back()->AddToArea(9,31);
-  _events.back()->AddToArea(10,31);
-  _events.back()->AddToArea(11,31);  
-
-    // dim lights on entering cave
-    _events.emplace_back(std::make_unique<MapEvent>(8, 31, Player::Vision::kCavern, ""));
-    _events.back()->AddToArea(9,31);
-    _events.back()->AddToArea(10,31);
-    _events.back()->AddToArea(11,31);  
-
-    // increase brightness when leaving cave
-    _events.emplace_back(std::make_unique<MapEvent>(8, 32, Player::Vision::kDaylight, ""));
-    _events.back()->AddToArea(9,32);
-    _events.back()->AddToArea(10,32);
-    _events.back()->AddToArea(11,32);  
-
-
-  // rock collection side quest
-  _events.emplace_back(std::make_unique<MapEvent>(4,19, MapEvent::EventType::kCollectionQuest, "", 30, 0));
-  _events.back()->AddToArea(28,1);
-  _events.back()->AddToArea(43,19);
-
-  // enter alcove main cavern
-  _events.emplace_back(std::make_unique<MapEvent>(18,27,"This small alcove is covered almost entirely with stalagmites. Droplets of water drip steady from the ceiling, hidden in the darkness above."));
-  
-  // spot a lizard
-  _events.emplace_back(std::make_unique<MapEvent>(26,14,"You spot a small lizard. It's eyes are milky-white.",1,0));
-
-  // trap
-  _events.emplace_back(std::make_unique<MapEvent>(34,6,"You trip and tumble against the wall. The vibrations break one of the stalagtites above. It crashes down before you even notice it.",0,5));
-  _events.back()->AddToArea(34,7);
-  _events.back()->AddToArea(35,7);
-  _events.back()->AddToArea(33,6);
-  _events.back()->AddToArea(33,7);
-  _events.back()->AddToArea(33,8);
-  _events.back()->AddToArea(34,8);
-  _events.back()->AddToArea(35,8);
-
-  // warn player of trap
-  _events.emplace_back(std::make_unique<MapEvent>(32,6,"There are a lot of stalagtites hanging from the ceiling. Some of them seem rather fragile."));
-  _events.back()->AddToArea(32,7);
-  _events.back()->AddToArea(32,8);
-  _events.back()->AddToArea(33,9);
-  _events.back()->AddToArea(34,9);
-  _events.back()->AddToArea(35,9);
-
-  // light change
-  // increase brightness when leaving corridor
-  _events.emplace_back(std::make_unique<MapEvent>(32, 1, Player::Vision::kCavern, ""));
-  // decrease brightness
-  _events.emplace_back(std::make_unique<MapEvent>(33,1, Player::Vision::kDark1, ""));
-  _events.emplace_back(std::make_unique<MapEvent>(33,1,"The corridor ahead is pitch black."));
-  _events.emplace_back(std::make_unique<MapEvent>(34,1, Player::Vision::kDark2, ""));
-  _events.emplace_back(std::make_unique<MapEvent>(34,1,"Maybe you should return?."));
-  _events.emplace_back(std::make_unique<MapEvent>(35,1, Player::Vision::kDark3, ""));
-  _events.emplace_back(std::make_unique<MapEvent>(35,1,"You can barely see your own hands."));
-
-
-  // a spooky encounter
-  _events.emplace_back(std::make_unique<MapEvent>(47,14,"As you venture deeper into the cave, you hear a strange sound ahead. It almost sounds like a something was moaning in the dark, but you're not quite sure."));
-  _events.back()->AddToArea(48,14);
-  _events.back()->AddToArea(49,14);
-  _events.emplace_back(std::make_unique<MapEvent>(44,23,"You notice a faint blue reflection on the cave wall ahead of you. It seems almost unnatural."));
-  _events.emplace_back(std::make_unique<MapEvent>(45,29,"Toward the back of the room an eerie apparition hovers in mid air. It's tanslucent skin shimmers in different hues of blue. Without lifting it's head, the figure begins to beckon you."));
-}
-
- 
-void Game::PlaceTreasure() {
-  // coins
-  {
-    std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
-    item->name = "Gold Coin";
-    item->number = 3;
-    std::string msg = "You found some golden coins scattered across the dirty floor.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(4, 26, Entity::Type::kTreasure, msg));
-    _treasure.back()->AddItem(std::move(item));
-  }
-  {
-    std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
-    item->name = "Gold Coin";
-    item->number = 1;
-    std::string msg = "You find a single gold coin hidden in the rubble.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(48, 20, Entity::Type::kTreasure,  msg));
-    _treasure.back()->AddItem(std::move(item));
+// register all entities in the per-tile index of the obstacle map and all events in the trigger map. from now on, both indices are kept up to date when entities move or are erased
+void Game::RegisterEntities() {
+  _obstaclemap.Register(&_player, OccupancyGrid::kPlayer, EntityHandle{});   // the player is not part of a registry
+  for (std::size_t i = 0; i < _npcs.size(); i++) {
+    _obstaclemap.Register(_npcs.At(i), OccupancyGrid::kNPC, _npcs.GetHandle(i));
   }
-
-  // add key
-  {
-    std::unique_ptr<InventoryItem> key = std::make_unique<InventoryItem>();
-    key->name = "Old Bronze Key";
-    key->number = 1;
-    key->isKey = true;
-    std::string msg = "A scuffed bronze key lies hidden beneath a pile of gnawed-off bones. You wonder how it ended up here.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(34, 15, Entity::Type::kTreasure,  msg));
-    _treasure.back()->AddItem(std::move(key));
+  for (std::size_t i = 0; i < _doors.size(); i++) {
+    _obstaclemap.Register(_doors.At(i)->GetAnchor(), OccupancyGrid::kDoor, _doors.GetHandle(i));
+    _obstaclemap.Register(_doors.At(i)->GetWing(), OccupancyGrid::kDoor, _doors.GetHandle(i));
   }
-
-  // rocks
-  {
-    std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
-    item->name = "Rock";
-    item->number = 1;
-    std::string msg = "You notice a pebble lying in the dust. It appears to be an ordinary stone.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(4, 19, Entity::Type::kTreasure, msg));
-    _treasure.back()->AddItem(std::move(item));
+  for (std::size_t i = 0; i < _opponents.size(); i++) {
+    _obstaclemap.Register(_opponents.At(i), OccupancyGrid::kOpponent, _opponents.GetHandle(i));
+    _opponents.At(i)->StartTurns(_tick);
+    _turns.Add(_opponents.GetHandle(i), _tick + _opponents.At(i)->GetMoveInterval());
   }
-  {
-    std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
-    item->name = "Rock";
-    item->number = 1;
-    std::string msg = "You glimpse a small piece of granite. A nice-looking quartz incursion runs along its surface.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(28, 1, Entity::Type::kTreasure, msg));
-    _treasure.back()->AddItem(std::move(item));
+  for (std::size_t i = 0; i < _treasure.size(); i++) {
+    OccupancyGrid::Layer layer = _treasure.At(i)->GetBlocksPath() ? OccupancyGrid::kChest : OccupancyGrid::kTreasure;
+    _obstaclemap.Register(_treasure.At(i), layer, _treasure.GetHandle(i));
   }
-  {
-    std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
-    item->name = "Rock";
-    item->number = 1;
-    std::string msg = "You find a smooth little rock. It's almost unremarkable. Almost.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(43, 19, Entity::Type::kTreasure, msg));
-    _treasure.back()->AddItem(std::move(item));
+  for (std::unique_ptr<MapEvent> &event : _events) {
+    _eventtriggers.Register(event.get());
   }
-
-  // potions
-  {
-    std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
-    item->name = "Strange-looking Potion";
-    item->number = 1;
-    item->healing = 6;
-    item->isSingleUseItem = true;  
-    std::string msg = "A skeleton lies slouched against the back of the cave. Stalagmites begin to grow on it's ancient bones. \nClutched between it's fingers is a small flacon made of clouded cristal. The reddish liquid inside seems to give of a faint glow.\n"; 
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(20, 29, Entity::Type::kTreasure,  msg));
-    _treasure.back()->AddItem(std::move(item)); 
-  }
-
-  // treasure chests
-  {
-    std::unique_ptr<InventoryItem> coins = std::make_unique<InventoryItem>();
-    coins->name = "Gold Coin";
-    coins->number = 10;
-    std::unique_ptr<InventoryItem> armor = std::make_unique<InventoryItem>();
-    armor->name = "Sturdy Hauberk";
-    armor->number = 1;
-    armor->attack_mod = 3;
-    armor->isArmor = true;
-    std::string msg = "You find an old wooden chest, covered in cobwebs. You open the lid carefully.\n";
-
-    _treasure.emplace_back(std::make_unique<InteractiveE>(26, 8, Entity::Type::kChest, msg));
-    _treasure.back()->AddItem(std::move(coins));
-    _treasure.back()->AddItem(std::move(armor));
-  }
-  {
-    std::unique_ptr<InventoryItem> mcguffin = std::make_unique<InventoryItem>();
-    mcguffin->name = "McGuffin";
-    mcguffin->number = 1;    
-    mcguffin->isMcGuffin = true;
-    std::string msg = "Tucked against the back of the wall is an ancient chest. Once it was locked, but the it's hinges have long since been corroded away by rust. Inside, you find an odd little thing made entirely out off gold.\n";
-    _treasure.emplace_back(std::make_unique<InteractiveE>(12, 2, Entity::Type::kChest, msg));
-    _treasure.back()->AddItem(std::move(mcguffin));
-  }
-
-  {
-    std::unique_ptr<InventoryItem> sword = std::make_unique<InventoryItem>();
-    sword->name = "Magic Blade";
-    sword->number = 1;
-    sword->attack_mod = 8;
-    sword->isWeapon = true;  
-    std::string msg = "As you approach, the apparition lifts its head. THe undead eyes seem to freeze your soul. As it speaks, it's voice is but the memory of a distance echo. 'Fellow traveler! I am the unlucky soul who ventured into this cave before you. Release me from this curse. Take my blade and avenge my death!' With a sigh of sadness and relief, the apparition vanishes into thin air.\n";
-    
-    _treasure.emplace_back(std::make_unique<InteractiveE>(46,34, Entity::Type::kLoot, msg));
-    _treasure.back()->AddItem(std::move(sword));
-  }
-  
-}
\ No newline at end of file
+}
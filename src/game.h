@@ -1,77 +1,145 @@
 #ifndef GAME_H
 #define GAME_H
 
-#include <random>
 #include <vector>
 #include <memory>
 
-#include "SDL.h"
+#include "command.h"
 #include "controller.h"
+#include "input_log.h"
 #include "renderer.h"
 #include "player.h"
 #include "opponent.h"
 #include "entity.h"
+#include "entity_store.h"
 #include "interactive_entity.h"
 #include "combattant.h"
 #include "door.h"
 #include "event.h"
+#include "event_trigger_map.h"
+#include "distance_map.h"
+#include "field_of_view.h"
+#include "occupancy_grid.h"
+#include "pcg32.h"
+#include "registry.h"
+#include "simulation_clock.h"
+#include "terrain_map.h"
+#include "turn_scheduler.h"
+#include "level_file.h"
+#include "light_map.h"
+#include "message_log.h"
 #include "tiletypes.h"
 
 
 class Game {
  public:
   // constructor
-  Game(std::size_t grid_width, std::size_t grid_height);
+  // all random rolls are derived from seed, i.e. a game is reproducible from its seed (and the player's input)
+  // all game messages are written to messages, which must outlive the game
+  Game(std::uint64_t seed, MessageLog &messages);
 
   // main method of this class
-  void Run(Controller const &controller, Renderer &renderer, std::size_t target_frame_duration);
+  // speed: multiplier of the simulation speed (e.g. for automated testing), SimulationClock::kUncapped to run as fast as possible
+  // the game loop is independent of SDL: controller & renderer are either the SDL front end or the headless implementations
+  void Run(Controller &controller, Renderer &renderer, std::size_t tick_duration, int speed = 1);
+
+  // headless runs without game loop (e.g. the batch runner simulate.cpp): the caller sets the player's direction and advances the 
+  // simulation tick by tick
+  void Step() { if (isActive()) { Update(); } }
+  bool isOver() const { return _won || !_player.alive; }
+  bool isWon() const { return _won; }
+  std::uint64_t GetTick() const { return _tick; }
+  Player &GetPlayer() { return _player; }
+  OccupancyGrid const &GetObstacles() const { return _obstaclemap; }   // walls & entities per tile, e.g. for a scripted player
+
+  // input recording & replay (see InputLog), to be started before Run. the log must outlive the game loop
+  // while a replay is running, live input is ignored (except for quitting). once all commands have been replayed, live input takes over
+  void StartRecording(InputLog &log);
+  void StartReplay(InputLog const &log);
+  bool hasReplayDiverged() const { return _divergedAt != 0; }
 
  private:
-  // check if a position is on the game map
-  bool IsOnMap(SDL_Point point);
-
-  // overloaded function for collision detection. returns true if collision (or pointer to colliding object, depending on return type)
-  // ROOM FOR IMPROVEMENT: #2 and #3 could be replaced by a template
-  bool DetectCollision(SDL_Point point, Entity *entity);
-  bool DetectCollision(SDL_Point point, std::vector<std::unique_ptr<Entity>> &entities);
-  bool DetectCollision(SDL_Point point, std::vector<std::unique_ptr<InteractiveE>> &entities);
-  Opponent* DetectCollision(SDL_Point point, std::vector<std::unique_ptr<Opponent>> &opponents);
-  Door* DetectCollision(SDL_Point point, std::vector<std::unique_ptr<Door>> &doors);
-    
-  // same as above, but invokes Interact() method in colliding object
-  bool DetectCollisionAndInteract(Player *player, SDL_Point point, std::vector<std::unique_ptr<InteractiveE>> &entities);
-  void TriggerMapEvents(Player *player, std::vector<std::unique_ptr<MapEvent>> &events);
-  
-  // get a representation of the game map where each element is either "kNone" or "kObstacle"
-  std::vector<std::vector<Entity::Type>> GetMapOfObstacles();
+  // collision detection, answered by the per-tile entity index of _obstaclemap
+  // returns true if any entity on the given layers (or impassable terrain, for kWall) occupies point. positions outside the map are blocked
+  bool DetectCollision(Point point, std::uint8_t layers) { return _obstaclemap.IsBlocked(point, layers); }
+  // returns the object of the registry which occupies point on one of the given layers (or nullptr)
+  template <typename T> T* DetectCollision(Point point, Registry<T> &registry, std::uint8_t layers) { return registry.Get(_obstaclemap.Find(point, layers)); }
 
+  void TriggerMapEvents(Player *player);
+  
   // calculate damage dealt by attacker
   void HandleFight (Combattant* attacker, Combattant* defender);
   
   // game map data
-  std::vector<std::vector<MapTiles::VicinityTileType>> _vicinitymap{};
-  std::vector<std::vector<MapTiles::Type>> _rendermap{};  
-  std::vector<std::vector<Entity::Type>> _obstaclemap{}; // not used yet
-  std::size_t _grid_max_x;
-  std::size_t _grid_max_y;
+  LevelFile _levelfile{};         // compiled level (see levelc). must outlive _terrain, which reads its tiles in place
+  TerrainMap _terrain{};          // tile types for rendering, passability & opacity
+  EntityStore _entities{};        // position, type & flags of all entities. must outlive all entities
+  OccupancyGrid _obstaclemap{};   // per-tile index of all entities on the map. main resource for path finding & collision detection
+  EventTriggerMap _eventtriggers{};   // per-tile index of map events
+  std::vector<MapEvent*> _triggered{};  // events triggered by the current step
 
   // vectors for objects on the game map
-  std::vector<std::unique_ptr<Entity>> _wall;
-  std::vector<std::unique_ptr<Opponent>> _opponents;
-  std::vector<std::unique_ptr<InteractiveE>> _npcs;
-  std::vector<std::unique_ptr<InteractiveE>> _treasure;
-  std::vector<std::unique_ptr<Door>> _doors;    
-  std::vector<std::unique_ptr<MapEvent>> _events;
+  Registry<Opponent> _opponents;
+  Registry<InteractiveE> _npcs;
+  Registry<InteractiveE> _treasure;
+  Registry<Door> _doors;    
+  Registry<MapEvent> _events;
+
+  // opponent turns. _tick counts the calls of Update(), i.e. the ticks of the simulation clock
+  TurnScheduler _turns{};
+  std::uint64_t _tick{0};
+
+  // opponent movement: distances to the player, shared by all opponents
+  DistanceMap _distancemap;
 
+  // tiles the player can see. used for rendering and by the opponents to spot the player
+  FieldOfView _fov;
+  void UpdateFieldOfView();
+
+  // light level of every tile: ambient zones of the level (seeded by the illumination events) and light sources. used for rendering
+  LightMap _lights;
+  void UpdateLights();
+  void AddLootLight(InteractiveE &loot);
+  static std::uint8_t GetAmbientLevel(Player::Vision vision);
   
+  // game messages, shared with the player. must be initialized before _player
+  MessageLog &_messages;
+  std::ostream &Messages() { return _messages.Stream(); }
+
   // no pointer, since number of players is always one
-  Player _player;    
+  Player _player{_entities, _messages};    
     
-  // random number engine
-  std::random_device dev;
-  std::mt19937 engine;
-  std::uniform_int_distribution<int> random_w;
-  std::uniform_int_distribution<int> random_h;
+  // random numbers: one stream for the fights, one stream per opponent (see PlaceLevelObjects)
+  std::uint64_t _seed;
+  Pcg32 _rng;
+
+  // event-driven game loop: the simulation only runs while the game is neither paused nor over
+  bool isActive() const { return !_paused && !_won && _player.alive; }
+  int TicksUntilNextAction() const;
+
+  // render-on-change: the scene is only redrawn if the visible state differs from the last rendered frame
+  bool HasVisibleChanges();
+  void MarkRendered();
+  unsigned int _renderedRevision{0};        // entity store revision: positions, types & appearance of all entities
+  std::uint64_t _renderedMessages{0};       // number of message lines
+  Player::Vision _renderedVision{Player::Vision::kDaylight};
+  unsigned int _renderedLights{0};          // light map revision
+  bool _renderedAlive{true};
+  bool _redrawRequested{true};              // draw first frame & repaint once per second (e.g. after the window has been uncovered)
+
+  // input: live commands from the controller and replayed commands take the same path
+  void ApplyInput(Command command, bool &running);
+  void ApplyReplayInput(bool &running);               // apply the replayed commands of the current tick
+  bool isReplaying() const { return _replay && _replayPos < _replay->GetEntries().size(); }
+  InputLog *_recording{nullptr};
+  InputLog const *_replay{nullptr};
+  std::size_t _replayPos{0};
+
+  // hash chain over the world state of every tick, checkpointed in the input log
+  void UpdateHashChain();
+  std::uint64_t HashWorldState() const;
+  std::uint64_t _hashChain{0};
+  std::uint64_t _divergedAt{0};       // tick of the first checkpoint which doesn't match the replayed log
 
   // game & movement control
   bool _paused{false};
@@ -81,12 +149,9 @@ class Game {
 
   // setting up the game
   void SetUpPlayer(int x, int y);  
-  void SetUpGameMap(std::string filepath);
-  void PlaceOpponents(); 
-  void PlaceTreasure();
-  void PlaceNPCs();  
-  void PlaceDoors();
-  void PlaceEvents();
+  void SetUpGameMap(std::string levelpath, std::string mappath, std::string objectpath);
+  void PlaceLevelObjects();
+  void RegisterEntities();
   void WelcomeMessage();
   
   // removing erased objects from data
@@ -0,0 +1,32 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include "SDL.h"
+
+// bitmap font for the text of the game window: the printable ASCII characters of a built-in 8x8 font, rasterized once into a
+// texture atlas of kColumns x kRows glyphs (white, coverage in the alpha channel). text is drawn by copying glyphs from the atlas,
+// tinted with SDL_SetTextureColorMod, so all text of a frame comes from a single texture
+class GlyphAtlas {
+ public:
+  static constexpr int kGlyphSize = 8;
+  static constexpr char kFirst = ' ';
+  static constexpr char kLast = '~';
+
+  explicit GlyphAtlas(SDL_Renderer *renderer);
+  ~GlyphAtlas();
+
+  GlyphAtlas(const GlyphAtlas &source) = delete;
+  GlyphAtlas &operator=(const GlyphAtlas &source) = delete;
+
+  SDL_Texture *GetTexture() const { return _texture; }
+  // source rectangle of a character in the atlas. characters without a glyph are shown as '?'
+  SDL_Rect GetGlyph(char c) const;
+
+ private:
+  static constexpr int kColumns = 16;
+  static constexpr int kRows = (kLast - kFirst + kColumns) / kColumns;
+
+  SDL_Texture *_texture{nullptr};
+};
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HEADLESS_CONTROLLER_H
+#define HEADLESS_CONTROLLER_H
+
+#include <cstdint>
+#include "controller.h"
+#include <vector>
+
+// controller for runs without a display (e.g. on build servers & benchmarks): no input and a virtual clock, which jumps to the 
+// end of every wait. the game loop therefore runs the simulation as fast as possible, with the same ticks as in real time
+// the game is quit once the clock has reached the given duration
+class HeadlessController : public Controller {
+ public:
+  explicit HeadlessController(std::uint32_t duration) : _duration(duration) {}
+
+  std::uint32_t GetTicks() override { return _now; }
+  void WaitForInput(std::uint32_t timeout, std::vector<Command> &commands) override;
+
+ private:
+  std::uint32_t _duration;
+  std::uint32_t _now{0};
+};
+
+#endif
@@ -0,0 +1,113 @@
+#include "input_log.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace {
+  constexpr char kMagic[4] = {'E', 'L', 'R', 'P'};
+  constexpr std::uint32_t kVersion = 1;
+
+  struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t seed;
+    std::uint32_t commands;   // number of commands
+    std::uint32_t hashes;     // number of hash checkpoints
+  };
+
+  template <typename T> void Append(std::vector<std::uint8_t> &out, T const &value) {
+    std::uint8_t const *bytes = reinterpret_cast<std::uint8_t const *>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+  }
+
+  template <typename T> bool Read(std::vector<std::uint8_t> const &in, std::size_t &pos, T &value) {
+    if (in.size() - pos < sizeof(T)) { return false; }
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+  }
+
+  void AppendVarint(std::vector<std::uint8_t> &out, std::uint64_t value) {
+    while (value >= 0x80) {
+      out.push_back(static_cast<std::uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+  }
+
+  bool ReadVarint(std::vector<std::uint8_t> const &in, std::size_t &pos, std::uint64_t &value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+      std::uint8_t byte = in[pos++];
+      value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) { return true; }
+    }
+    return false;
+  }
+}
+
+// write the log to a binary file
+bool InputLog::Save(std::string const &path) const {
+  std::vector<std::uint8_t> image;
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.seed = _seed;
+  header.commands = static_cast<std::uint32_t>(_entries.size());
+  header.hashes = static_cast<std::uint32_t>(_hashes.size());
+  Append(image, header);
+
+  std::uint64_t tick = 0;
+  for (Entry const &entry : _entries) {
+    AppendVarint(image, entry.tick - tick);
+    image.push_back(static_cast<std::uint8_t>(entry.command));
+    tick = entry.tick;
+  }
+  for (std::uint64_t hash : _hashes) { Append(image, hash); }
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<char const *>(image.data()), static_cast<std::streamsize>(image.size()));
+  return static_cast<bool>(file);
+}
+
+// read a log written by Save
+bool InputLog::Load(std::string const &path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    std::cerr << "Error: Input log '" << path << "' could not be opened!" << std::endl;
+    return false;
+  }
+  std::vector<std::uint8_t> image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  std::size_t pos = 0;
+  Header header;
+  if (!Read(image, pos, header) || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) {
+    std::cerr << "Error: '" << path << "' is not an input log of version " << kVersion << std::endl;
+    return false;
+  }
+  _seed = header.seed;
+  _entries.clear();
+  _hashes.clear();
+  std::uint64_t tick = 0;
+  for (std::uint32_t i = 0; i < header.commands; i++) {
+    std::uint64_t delta;
+    std::uint8_t command;
+    if (!ReadVarint(image, pos, delta) || !Read(image, pos, command) || command > static_cast<std::uint8_t>(Command::kSelectItem9)) {
+      std::cerr << "Error: Input log '" << path << "' is corrupt (command " << i << ")" << std::endl;
+      return false;
+    }
+    tick += delta;
+    _entries.push_back({tick, static_cast<Command>(command)});
+  }
+  for (std::uint32_t i = 0; i < header.hashes; i++) {
+    std::uint64_t hash;
+    if (!Read(image, pos, hash)) {
+      std::cerr << "Error: Input log '" << path << "' is truncated (hash " << i << ")" << std::endl;
+      return false;
+    }
+    _hashes.push_back(hash);
+  }
+  return true;
+}
@@ -0,0 +1,38 @@
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "command.h"
+
+// recorded input of a game session: the seed and all commands, stamped with the tick after which they were applied, and a 
+// checkpoint of the game's world-state hash chain every kHashInterval ticks (see Game::UpdateHashChain). replaying the commands 
+// on a game with the same seed reproduces the session tick by tick, the checkpoints detect divergences
+// file layout: header | commands (tick delta as LEB128 varint, command byte) | hashes (8 bytes each), native byte order
+class InputLog {
+ public:
+  struct Entry {
+    std::uint64_t tick;
+    Command command;
+  };
+
+  static constexpr std::uint64_t kHashInterval = 60;
+
+  void SetSeed(std::uint64_t seed) { _seed = seed; }
+  std::uint64_t GetSeed() const { return _seed; }
+  void Add(std::uint64_t tick, Command command) { _entries.push_back({tick, command}); }
+  void AddHash(std::uint64_t hash) { _hashes.push_back(hash); }
+  std::vector<Entry> const &GetEntries() const { return _entries; }
+  std::vector<std::uint64_t> const &GetHashes() const { return _hashes; }
+
+  bool Save(std::string const &path) const;
+  bool Load(std::string const &path);
+
+ private:
+  std::uint64_t _seed{0};
+  std::vector<Entry> _entries{};
+  std::vector<std::uint64_t> _hashes{};
+};
+
+#endif
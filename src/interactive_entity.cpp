@@ -2,7 +2,7 @@
 #include <iostream>
 
 // constructor for questgiver - a stationary entity that provides dialogue lines upon collision with player
-InteractiveE::InteractiveE(int x, int y, std::string filename) : Entity(x, y, Type::kNPC), _filename(filename)
+InteractiveE::InteractiveE(EntityStore &store, int x, int y, std::string filename) : Entity(store, x, y, Type::kNPC), _filename(filename)
 {
     SetBlocksPath(true);
     _questgiverDialogue = ReadDialogueFromFile(filename);
@@ -10,7 +10,7 @@ InteractiveE::InteractiveE(int x, int y, std::string filename) : Entity(x, y, Ty
 }
 
 // constructor for treasure - a stationary entity that moves a item into the player's inventory upon collision
-InteractiveE::InteractiveE(int x, int y, Type type, std::string pickUpText) : Entity(x, y, type), _pickUpText(pickUpText) { 
+InteractiveE::InteractiveE(EntityStore &store, int x, int y, Type type, std::string pickUpText) : Entity(store, x, y, type), _pickUpText(pickUpText) { 
     // set block path property if not a chest
     if (type == Type::kLoot || type == Type::kTreasure) 
     SetBlocksPath(false);     
@@ -33,11 +33,11 @@ void InteractiveE::Interact(Player *player)
 
 // move content of _treasure to player's inventory    
 void InteractiveE::PickUpItems(Player *player) { 
-    std::cout << "---------------" << std::endl;
-    std::cout << _pickUpText; //no endline here to prevent line breaks if msg is empty.
+    player->Messages() << "---------------" << std::endl;
+    player->Messages() << _pickUpText; //no endline here to prevent line breaks if msg is empty.
 
     if(_treasure.empty()) {
-        std::cout << "There are no items to be picked up." << std::endl;
+        player->Messages() << "There are no items to be picked up." << std::endl;
     } else {
         for (std::unique_ptr<InventoryItem> &item : _treasure) {
             player->receiveItem(std::move(item));
@@ -52,9 +52,9 @@ void InteractiveE::Talk(Player *player)
 {
     // confirm that player has not found the main quest object yet
     if (!player->hasMcGuffin()) {            
-        std::cout << "---------------" << std::endl;
+        player->Messages() << "---------------" << std::endl;
         // if (_annoyance >= _questgiverDialogue.size()) { return; }        // uncomment to avoid the intentional segmentation fault caused by the line below.
-        std::cout << _questgiverDialogue.at(_annoyance++) << std::endl;		// this line WILL eventually cause an intentional segmentation fault. it's not a bug, it's a feature ;D	
+        player->Messages() << _questgiverDialogue.at(_annoyance++) << std::endl;		// this line WILL eventually cause an intentional segmentation fault. it's not a bug, it's a feature ;D	
         
         // hard coded reward for dialogue options. eventually this should be created from a file parser 
         if (_annoyance == 6) { player->ReceiveXP(20); }
@@ -75,46 +75,46 @@ void InteractiveE::Talk(Player *player)
         std::unique_ptr<InventoryItem> coins = std::make_unique<InventoryItem>();
         coins->name = "Gold Coin";
 
-        std::cout << "---------------" << std::endl;
+        player->Messages() << "---------------" << std::endl;
         // response & reward depend on how much the player has annoyed the quest giver
         switch (_annoyance) {
             case 0 ... 2: 
-                std::cout << _questgiverFinalResponse.at(0) << std::endl;
+                player->Messages() << _questgiverFinalResponse.at(0) << std::endl;
                 coins->number = 50;
                 player->receiveItem(std::move(coins));
                 player->ReceiveXP(250);
                 break;
 
             case 3 ... 5:
-                std::cout << _questgiverFinalResponse.at(1) << std::endl;
+                player->Messages() << _questgiverFinalResponse.at(1) << std::endl;
                 coins->number = 30;
                 player->receiveItem(std::move(coins));
                 player->ReceiveXP(250);
                 break;
                     
             case 6:
-                std::cout << _questgiverFinalResponse.at(2) << std::endl;
+                player->Messages() << _questgiverFinalResponse.at(2) << std::endl;
                 coins->number = 50;
                 player->receiveItem(std::move(coins));
                 player->ReceiveXP(250);
                 break;
                 
             case 7 ... 9:
-                std::cout << _questgiverFinalResponse.at(3) << std::endl;
+                player->Messages() << _questgiverFinalResponse.at(3) << std::endl;
                 coins->number = 25;
                 player->receiveItem(std::move(coins));
                 player->ReceiveXP(250);
                 break;
 
             case 10 ... 12:
-                std::cout << _questgiverFinalResponse.at(4) << std::endl;
+                player->Messages() << _questgiverFinalResponse.at(4) << std::endl;
                 coins->number = 25;
                 player->receiveItem(std::move(coins));
                 player->ReceiveXP(250);
                 break;
                     
             default:
-                std::cout << _questgiverFinalResponse.at(5) << std::endl;
+                player->Messages() << _questgiverFinalResponse.at(5) << std::endl;
                 coins->number = 25;
                 player->receiveItem(std::move(coins));
                 player->ReceiveXP(250);
@@ -4,7 +4,7 @@
 #include <vector>
 #include <string>
 #include <memory>
-#include "SDL.h"
+#include "point.h"
 #include "entity.h"
 #include "player.h"
 
@@ -17,10 +17,10 @@ class InteractiveE : public Entity {
   public:
     // POSSIBLE IMPROVEMENT: split into separate classes NPC and Treasure:
     // constructor for questgiver (NPC) - a stationary entity that provides dialogue lines upon collision with player
-    InteractiveE(int x, int y, std::string filename); 
+    InteractiveE(EntityStore &store, int x, int y, std::string filename); 
    
     // constructor for treasure - a stationary entity that moves a item into the player's inventory upon collision
-    InteractiveE(int x, int y, Type type, std::string pickUpText);
+    InteractiveE(EntityStore &store, int x, int y, Type type, std::string pickUpText);
 
     // after creating an (empty) instance, lootable objects need to be added     
     void AddItem(std::unique_ptr<InventoryItem> item) { _treasure.emplace_back(std::move(item)); }
@@ -0,0 +1,253 @@
+#include "level_compiler.h"
+#include "level_file.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+
+  // collects the tables of a level while the object description is parsed
+  struct LevelTables {
+    std::vector<LevelFormat::EntityRecord> entities{};
+    std::vector<LevelFormat::ItemRecord> items{};
+    std::vector<LevelFormat::EventRecord> events{};
+    std::vector<LevelFormat::AreaRecord> area{};
+    std::vector<char> strings{};
+    std::unordered_map<std::string, std::uint32_t> stringOffsets{};
+
+    // store each distinct string only once
+    std::uint32_t Intern(std::string const &text) {
+      auto it = stringOffsets.find(text);
+      if (it != stringOffsets.end()) { return it->second; }
+      std::uint32_t offset = static_cast<std::uint32_t>(strings.size());
+      strings.insert(strings.end(), text.begin(), text.end());
+      strings.push_back('\0');
+      stringOffsets.emplace(text, offset);
+      return offset;
+    }
+  };
+
+  // read a double-quoted string. supports the escape sequences \n, \" and \\ .
+  bool ReadQuoted(std::istringstream &linestream, std::string &text) {
+    char c;
+    if (!(linestream >> c) || c != '"') { return false; }
+    text.clear();
+    while (linestream.get(c)) {
+      if (c == '"') { return true; }
+      if (c == '\\' && linestream.get(c)) {
+        if (c == 'n') { c = '\n'; }
+      }
+      text.push_back(c);
+    }
+    return false;
+  }
+
+  // split an optional "key=value" token
+  bool ReadOption(std::string const &token, std::string const &key, std::int32_t &value) {
+    if (token.compare(0, key.size() + 1, key + "=") != 0) { return false; }
+    value = std::stoi(token.substr(key.size() + 1));
+    return true;
+  }
+
+  bool ParseVision(std::string const &name, std::uint8_t &vision) {
+    static const char *kNames[] = {"daylight", "cavern", "dark1", "dark2", "dark3"};   // order of Player::Vision
+    for (std::uint8_t i = 0; i < 5; i++) {
+      if (name == kNames[i]) {
+        vision = i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ParseTreasure(std::istringstream &linestream, LevelTables &tables) {
+    LevelFormat::EntityRecord record{};
+    std::string kind, text;
+    if (!(linestream >> record.x >> record.y >> kind) || !ReadQuoted(linestream, text)) { return false; }
+    if (kind == "treasure") { record.kind = LevelFormat::EntityKind::kTreasure; }
+    else if (kind == "chest") { record.kind = LevelFormat::EntityKind::kChest; }
+    else if (kind == "loot") { record.kind = LevelFormat::EntityKind::kLoot; }
+    else { return false; }
+    record.text = tables.Intern(text);
+    record.firstItem = static_cast<std::uint32_t>(tables.items.size());
+    tables.entities.push_back(record);
+    return true;
+  }
+
+  // items belong to the preceding treasure
+  bool ParseItem(std::istringstream &linestream, LevelTables &tables) {
+    if (tables.entities.empty()) { return false; }
+    LevelFormat::EntityRecord &owner = tables.entities.back();
+    if (owner.kind != LevelFormat::EntityKind::kTreasure && owner.kind != LevelFormat::EntityKind::kChest && owner.kind != LevelFormat::EntityKind::kLoot) { return false; }
+
+    LevelFormat::ItemRecord item{};
+    std::string name, token;
+    if (!ReadQuoted(linestream, name) || !(linestream >> item.number)) { return false; }
+    item.name = tables.Intern(name);
+    while (linestream >> token) {
+      if (ReadOption(token, "attack", item.attack_mod) || ReadOption(token, "defense", item.defense_mod) || ReadOption(token, "healing", item.healing)) { continue; }
+      else if (token == "singleuse") { item.flags |= LevelFormat::kSingleUse; }
+      else if (token == "weapon") { item.flags |= LevelFormat::kWeapon; }
+      else if (token == "armor") { item.flags |= LevelFormat::kArmor; }
+      else if (token == "key") { item.flags |= LevelFormat::kKey; }
+      else if (token == "mcguffin") { item.flags |= LevelFormat::kMcGuffin; }
+      else { return false; }
+    }
+    tables.items.push_back(item);
+    owner.itemCount++;
+    return true;
+  }
+
+  bool ParseOpponent(std::istringstream &linestream, LevelTables &tables) {
+    // default stats of an orc
+    LevelFormat::EntityRecord record{};
+    record.kind = LevelFormat::EntityKind::kOpponent;
+    record.maxHP = 8;
+    record.attack = 6;
+    record.defense = 6;
+    record.agility = 1;
+    record.xp = 15;
+    std::string name, token;
+    if (!(linestream >> record.x >> record.y) || !ReadQuoted(linestream, name)) { return false; }
+    record.text = tables.Intern(name);
+    while (linestream >> token) {
+      if (ReadOption(token, "hp", record.maxHP) || ReadOption(token, "attack", record.attack) || ReadOption(token, "defense", record.defense) ||
+          ReadOption(token, "agility", record.agility) || ReadOption(token, "xp", record.xp)) { continue; }
+      return false;
+    }
+    tables.entities.push_back(record);
+    return true;
+  }
+
+  bool ParseNPC(std::istringstream &linestream, LevelTables &tables) {
+    LevelFormat::EntityRecord record{};
+    record.kind = LevelFormat::EntityKind::kNPC;
+    std::string filename, token;
+    if (!(linestream >> record.x >> record.y) || !ReadQuoted(linestream, filename)) { return false; }
+    record.text = tables.Intern(filename);
+    while (linestream >> token) {
+      if (token == "mainquest") { record.flags |= LevelFormat::kMainQuestGiver; }
+      else { return false; }
+    }
+    tables.entities.push_back(record);
+    return true;
+  }
+
+  bool ParseDoor(std::istringstream &linestream, LevelTables &tables) {
+    LevelFormat::EntityRecord record{};
+    record.kind = LevelFormat::EntityKind::kDoor;
+    std::string orientation, token;
+    if (!(linestream >> record.x >> record.y >> orientation)) { return false; }
+    if (orientation == "horizontal") { record.flags |= LevelFormat::kHorizontal; }
+    else if (orientation != "vertical") { return false; }
+    while (linestream >> token) {
+      if (token == "secret") { record.flags |= LevelFormat::kSecret; }
+      else if (token == "locked") { record.flags |= LevelFormat::kLocked; }
+      else { return false; }
+    }
+    tables.entities.push_back(record);
+    return true;
+  }
+
+  bool ParseEvent(std::istringstream &linestream, LevelTables &tables) {
+    LevelFormat::EventRecord record{};
+    std::string type, msg, token;
+    if (!(linestream >> record.x >> record.y >> type)) { return false; }
+    // type values follow MapEvent::EventType
+    if (type == "single") { record.type = 0; }
+    else if (type == "persistent") { record.type = 1; }
+    else if (type == "illumination") { record.type = 2; }
+    else if (type == "collection") { record.type = 3; }
+    else { return false; }
+    // the message is optional
+    linestream >> std::ws;
+    if (linestream.peek() == '"' && !ReadQuoted(linestream, msg)) { return false; }
+    record.msg = tables.Intern(msg);
+    while (linestream >> token) {
+      if (ReadOption(token, "xp", record.xp) || ReadOption(token, "damage", record.dmg)) { continue; }
+      else if (token.compare(0, 7, "vision=") == 0 && ParseVision(token.substr(7), record.vision)) { continue; }
+      return false;
+    }
+    record.firstTile = static_cast<std::uint32_t>(tables.area.size());
+    tables.events.push_back(record);
+    return true;
+  }
+
+  // area tiles belong to the preceding event
+  bool ParseArea(std::istringstream &linestream, LevelTables &tables) {
+    if (tables.events.empty()) { return false; }
+    LevelFormat::AreaRecord tile{};
+    int tiles = 0;
+    while (linestream >> tile.x >> tile.y) {
+      tables.area.push_back(tile);
+      tables.events.back().tileCount++;
+      tiles++;
+    }
+    return tiles > 0 && linestream.eof();
+  }
+
+  // append a table to the image and return its location
+  template <typename T> LevelFormat::Table AppendTable(std::vector<std::uint8_t> &image, T const *data, std::size_t count) {
+    // keep all tables 4-byte aligned
+    while (image.size() % 4 != 0) { image.push_back(0); }
+    LevelFormat::Table table{static_cast<std::uint32_t>(image.size()), static_cast<std::uint32_t>(count)};
+    std::uint8_t const *bytes = reinterpret_cast<std::uint8_t const *>(data);
+    image.insert(image.end(), bytes, bytes + count * sizeof(T));
+    return table;
+  }
+}
+
+bool LevelCompiler::Compile(TerrainMap const &terrain, std::string const &objectpath, std::vector<std::uint8_t> &image) {
+  std::ifstream objectfile(objectpath);
+  if (!objectfile) {
+    std::cerr << "Error: Level object file '" << objectpath << "' could not be opened!" << std::endl;
+    return false;
+  }
+
+  // parse object description line by line. empty lines and lines starting with '#' are ignored
+  LevelTables tables{};
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(objectfile, line)) {
+    lineNumber++;
+    std::istringstream linestream(line);
+    std::string keyword;
+    if (!(linestream >> keyword) || keyword[0] == '#') { continue; }
+
+    bool valid = false;
+    try {
+      if (keyword == "treasure") { valid = ParseTreasure(linestream, tables); }
+      else if (keyword == "item") { valid = ParseItem(linestream, tables); }
+      else if (keyword == "opponent") { valid = ParseOpponent(linestream, tables); }
+      else if (keyword == "npc") { valid = ParseNPC(linestream, tables); }
+      else if (keyword == "door") { valid = ParseDoor(linestream, tables); }
+      else if (keyword == "event") { valid = ParseEvent(linestream, tables); }
+      else if (keyword == "area") { valid = ParseArea(linestream, tables); }
+    }
+    catch (std::exception const &) { valid = false; }   // malformed number in a key=value option
+
+    if (!valid) {
+      std::cerr << "Error: " << objectpath << ":" << lineNumber << ": invalid line '" << line << "'" << std::endl;
+      return false;
+    }
+  }
+
+  // assemble image: header first, tables follow
+  image.assign(sizeof(LevelFormat::Header), 0);
+  LevelFormat::Header header{};
+  std::memcpy(header.magic, LevelFormat::kMagic, sizeof(header.magic));
+  header.version = LevelFormat::kVersion;
+  header.width = static_cast<std::uint32_t>(terrain.GetWidth());
+  header.height = static_cast<std::uint32_t>(terrain.GetHeight());
+  header.tiles = AppendTable(image, terrain.GetTiles(), header.width * header.height);
+  header.entities = AppendTable(image, tables.entities.data(), tables.entities.size());
+  header.items = AppendTable(image, tables.items.data(), tables.items.size());
+  header.events = AppendTable(image, tables.events.data(), tables.events.size());
+  header.area = AppendTable(image, tables.area.data(), tables.area.size());
+  header.strings = AppendTable(image, tables.strings.data(), tables.strings.size());
+  std::memcpy(image.data(), &header, sizeof(header));
+  return true;
+}
@@ -0,0 +1,17 @@
+#ifndef LEVEL_COMPILER_H
+#define LEVEL_COMPILER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "terrain_map.h"
+
+// builds the binary level image (see level_file.h) from a terrain map and a level object description (see levelobjects.txt)
+// used offline by levelc and by the game as fallback if the level has not been compiled
+namespace LevelCompiler {
+  // returns false and prints the offending line if the object description can't be read or contains errors
+  bool Compile(TerrainMap const &terrain, std::string const &objectpath, std::vector<std::uint8_t> &image);
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include "level_file.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "terrain_map.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LEVEL_FILE_MMAP
+#endif
+
+// map file and validate header
+bool LevelFile::Open(std::string const &path) {
+  Close();
+
+#ifdef LEVEL_FILE_MMAP
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) { return false; }
+  struct stat info;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    void *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      _data = static_cast<std::uint8_t const *>(data);
+      _size = static_cast<std::size_t>(info.st_size);
+      _mapped = true;
+    }
+  }
+  close(fd);
+#else
+  // no mmap available: read the whole file at once
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (file) {
+    _buffer.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (file.read(reinterpret_cast<char *>(_buffer.data()), _buffer.size()) && !_buffer.empty()) {
+      _data = _buffer.data();
+      _size = _buffer.size();
+    }
+  }
+#endif
+
+  if (_data == nullptr) { return false; }
+  if (!Validate()) {
+    std::cerr << "Error: Level file '" << path << "' is invalid or was compiled with an incompatible version of levelc!" << std::endl;
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void LevelFile::Close() {
+#ifdef LEVEL_FILE_MMAP
+  if (_mapped && _data != nullptr) { munmap(const_cast<std::uint8_t *>(_data), _size); }
+#endif
+  _data = nullptr;
+  _size = 0;
+  _mapped = false;
+  _buffer.clear();
+}
+
+// use a level image compiled in memory instead of a file
+bool LevelFile::Open(std::vector<std::uint8_t> image) {
+  Close();
+  _buffer = std::move(image);
+  if (_buffer.empty()) { return false; }
+  _data = _buffer.data();
+  _size = _buffer.size();
+  if (!Validate()) {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+// check magic number, version and that all tables are within the file and aligned for their records
+bool LevelFile::Validate() const {
+  if (_size < sizeof(LevelFormat::Header)) { return false; }
+  LevelFormat::Header const &header = GetHeader();
+  if (std::memcmp(header.magic, LevelFormat::kMagic, sizeof(header.magic)) != 0) { return false; }
+  if (header.version != LevelFormat::kVersion) { return false; }
+  if (header.width > INT32_MAX || header.height > INT32_MAX) { return false; }
+  if (header.tiles.count != static_cast<std::uint64_t>(header.width) * header.height) { return false; }
+  if (!(isTableValid<std::uint8_t>(header.tiles) && isTableValid<LevelFormat::EntityRecord>(header.entities) &&
+        isTableValid<LevelFormat::ItemRecord>(header.items) && isTableValid<LevelFormat::EventRecord>(header.events) &&
+        isTableValid<LevelFormat::AreaRecord>(header.area) && isTableValid<char>(header.strings))) { return false; }
+  // the last string has to be terminated
+  if (header.strings.count > 0 && _data[header.strings.offset + header.strings.count - 1] != '\0') { return false; }
+
+  // the terrain map reads the tiles in place: each tile has to hold a known type and the flags derived from it
+  std::uint8_t const *tiles = GetTiles();
+  for (std::uint32_t i = 0; i < header.tiles.count; i++) {
+    int type = tiles[i] & TerrainMap::kTypeMask;
+    if (type > static_cast<int>(MapTiles::Type::kGras) || tiles[i] != TerrainMap::Encode(static_cast<MapTiles::Type>(type))) { return false; }
+  }
+
+  // check references between tables, so that the game can read the records without further checks
+  LevelFormat::EntityRecord const *entities = GetTable<LevelFormat::EntityRecord>(header.entities);
+  for (std::uint32_t i = 0; i < header.entities.count; i++) {
+    if (entities[i].kind > LevelFormat::EntityKind::kDoor || entities[i].text >= header.strings.count) { return false; }
+    if (static_cast<std::uint64_t>(entities[i].firstItem) + entities[i].itemCount > header.items.count) { return false; }
+  }
+  LevelFormat::ItemRecord const *items = GetTable<LevelFormat::ItemRecord>(header.items);
+  for (std::uint32_t i = 0; i < header.items.count; i++) {
+    if (items[i].name >= header.strings.count) { return false; }
+  }
+  LevelFormat::EventRecord const *events = GetTable<LevelFormat::EventRecord>(header.events);
+  for (std::uint32_t i = 0; i < header.events.count; i++) {
+    if (events[i].type > 3 || events[i].vision > 4 || events[i].msg >= header.strings.count) { return false; }
+    if (static_cast<std::uint64_t>(events[i].firstTile) + events[i].tileCount > header.area.count) { return false; }
+  }
+  return true;
+}
+
+// write a level image to file
+bool LevelFile::Write(std::string const &path, std::vector<std::uint8_t> const &image) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) { return false; }
+  file.write(reinterpret_cast<char const *>(image.data()), image.size());
+  return static_cast<bool>(file);
+}
@@ -0,0 +1,121 @@
+#ifndef LEVEL_FILE_H
+#define LEVEL_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// binary level format, produced by the level compiler (see levelc) from the text map and the level object description
+// layout: header | tables, each table referenced by byte offset and element count in the header
+// all values are stored in native byte order and tables are 4-byte aligned, so the file can be mapped into memory and read in place
+namespace LevelFormat {
+  constexpr char kMagic[4] = {'E', 'L', 'V', 'L'};
+  constexpr std::uint32_t kVersion = 2;
+
+  struct Table {
+    std::uint32_t offset;   // byte offset from start of file
+    std::uint32_t count;    // number of elements
+  };
+
+  struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t width;
+    std::uint32_t height;
+    Table tiles;            // width * height bytes, row-major, encoded as in TerrainMap
+    Table entities;         // EntityRecord: objects placed on the map
+    Table items;            // ItemRecord: content of treasure, referenced by entities
+    Table events;           // EventRecord: map events
+    Table area;             // AreaRecord: tiles covered by events, referenced by events
+    Table strings;          // null-terminated strings, referenced by byte offset into this table. each string is stored only once
+  };
+
+  enum class EntityKind : std::uint8_t { kTreasure, kChest, kLoot, kOpponent, kNPC, kDoor };
+  enum EntityFlags : std::uint8_t { kMainQuestGiver = 1, kHorizontal = 2, kSecret = 4, kLocked = 8 };
+
+  struct EntityRecord {
+    EntityKind kind;
+    std::uint8_t flags;
+    std::uint16_t reserved;
+    std::int32_t x;
+    std::int32_t y;
+    std::uint32_t text;         // pick up text (treasure), dialogue file (NPC) or name (opponent)
+    std::uint32_t firstItem;    // treasure content: index of first item and number of items
+    std::uint32_t itemCount;
+    std::int32_t maxHP;         // opponent stats
+    std::int32_t attack;
+    std::int32_t defense;
+    std::int32_t agility;
+    std::int32_t xp;
+  };
+
+  enum ItemFlags : std::uint32_t { kSingleUse = 1, kWeapon = 2, kArmor = 4, kKey = 8, kMcGuffin = 16 };
+
+  struct ItemRecord {
+    std::uint32_t name;
+    std::int32_t number;
+    std::int32_t attack_mod;
+    std::int32_t defense_mod;
+    std::int32_t healing;
+    std::uint32_t flags;
+  };
+
+  // event types and vision levels are stored with the values of MapEvent::EventType and Player::Vision
+  struct EventRecord {
+    std::uint8_t type;
+    std::uint8_t vision;
+    std::uint16_t reserved;
+    std::int32_t x;
+    std::int32_t y;
+    std::uint32_t msg;
+    std::int32_t xp;
+    std::int32_t dmg;
+    std::uint32_t firstTile;    // additional tiles of the event area: index of first tile and number of tiles
+    std::uint32_t tileCount;
+  };
+
+  struct AreaRecord {
+    std::int32_t x;
+    std::int32_t y;
+  };
+}
+
+// read-only view of a compiled level. the file is memory-mapped (where supported), nothing is parsed or copied
+class LevelFile {
+ public:
+  LevelFile() {};
+  ~LevelFile() { Close(); }
+  LevelFile(const LevelFile &source) = delete;
+  LevelFile &operator=(const LevelFile &source) = delete;
+
+  // map file and validate header. returns false if the file can't be read or is not a valid level
+  bool Open(std::string const &path);
+  // use a level image compiled in memory instead of a file
+  bool Open(std::vector<std::uint8_t> image);
+  void Close();
+  bool isOpen() const { return _data != nullptr; }
+
+  // getters. only valid while the file is open
+  LevelFormat::Header const &GetHeader() const { return *reinterpret_cast<LevelFormat::Header const *>(_data); }
+  std::uint8_t const *GetTiles() const { return _data + GetHeader().tiles.offset; }
+  template <typename T> T const *GetTable(LevelFormat::Table const &table) const { return reinterpret_cast<T const *>(_data + table.offset); }
+  char const *GetString(std::uint32_t offset) const { return reinterpret_cast<char const *>(_data + GetHeader().strings.offset + offset); }
+
+  // write a level image to file (used by levelc)
+  static bool Write(std::string const &path, std::vector<std::uint8_t> const &image);
+
+ private:
+  bool Validate() const;
+  // the table's records are within the file and its offset is aligned for T, as GetTable<T> reads them in place
+  template <typename T> bool isTableValid(LevelFormat::Table const &table) const {
+    return table.offset % alignof(T) == 0 && static_cast<std::uint64_t>(table.offset) + static_cast<std::uint64_t>(table.count) * sizeof(T) <= _size;
+  }
+
+  std::uint8_t const *_data{nullptr};
+  std::size_t _size{0};
+  bool _mapped{false};                // false if the level is held in _buffer instead
+  std::vector<std::uint8_t> _buffer{};
+};
+
+#endif
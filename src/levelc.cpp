@@ -0,0 +1,33 @@
+#include <iostream>
+#include <string>
+
+#include "game_utils.h"
+#include "level_compiler.h"
+#include "level_file.h"
+
+// offline level compiler: converts a text map (see levelmap.txt) and a level object description (see levelobjects.txt) into the binary level format read by the game
+// usage: levelc <map.txt> <objects.txt> <output.lvl>
+int main(int argc, char *argv[]) {
+  if (argc != 4) {
+    std::cerr << "usage: " << argv[0] << " <map.txt> <objects.txt> <output.lvl>" << std::endl;
+    return 1;
+  }
+
+  TerrainMap terrain = GameUtils::GetTerrainMap(argv[1]);
+  if (terrain.GetWidth() == 0 || terrain.GetHeight() == 0) {
+    std::cerr << "Error: No map tiles found in '" << argv[1] << "'" << std::endl;
+    return 1;
+  }
+
+  std::vector<std::uint8_t> image;
+  if (!LevelCompiler::Compile(terrain, argv[2], image)) { return 1; }
+
+  if (!LevelFile::Write(argv[3], image)) {
+    std::cerr << "Error: Level file '" << argv[3] << "' could not be written!" << std::endl;
+    return 1;
+  }
+  LevelFormat::Header const &header = *reinterpret_cast<LevelFormat::Header const *>(image.data());
+  std::cout << "levelc: " << argv[1] << " + " << argv[2] << " -> " << argv[3] << " (" << header.width << "x" << header.height << " tiles, "
+            << header.entities.count << " objects, " << header.items.count << " items, " << header.events.count << " events)" << std::endl;
+  return 0;
+}
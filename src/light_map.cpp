@@ -0,0 +1,173 @@
+#include "light_map.h"
+
+#include <algorithm>
+#include <cmath>
+
+// directional deltas
+static const int delta[4][2]{{-1, 0}, {0, -1}, {1, 0}, {0, 1}};
+
+// grow all zones at once with a breadth-first search from their seeds: a tile belongs to the zone which reaches it first
+void LightMap::Init(TerrainMap const &terrain, std::vector<Zone> const &zones) {
+  _width = terrain.GetWidth();
+  _height = terrain.GetHeight();
+  _ambient.assign(_width * _height, kDaylight);
+  _lights.clear();
+  _index.clear();
+  _changed.clear();
+  _dirty.clear();
+  _queue.clear();
+  _revision++;
+
+  std::vector<bool> reached(_ambient.size(), false);
+  for (Zone const &zone : zones) {
+    if (!IsOnMap(zone.seed)) { continue; }
+    int const cell = zone.seed.y * _width + zone.seed.x;
+    if (reached[cell]) { continue; }    // seeds of several zones on the same tile: the first one wins
+    reached[cell] = true;
+    _ambient[cell] = zone.level;
+    _queue.push_back(cell);
+  }
+
+  for (std::size_t head = 0; head < _queue.size(); head++) {
+    int const cell = _queue[head];
+    int const x = cell % _width;
+    int const y = cell / _width;
+
+    for (int i = 0; i < 4; i++) {
+      Point neighbor{x + delta[i][0], y + delta[i][1]};
+      if (!IsOnMap(neighbor)) { continue; }
+      int const next = neighbor.y * _width + neighbor.x;
+      if (reached[next]) { continue; }
+      reached[next] = true;
+      _ambient[next] = _ambient[cell];
+      // the light of a zone doesn't spread through walls
+      if (terrain.IsPassable(neighbor)) { _queue.push_back(next); }
+    }
+  }
+  _levels = _ambient;
+}
+
+void LightMap::SetLight(int id, Point position, int radius, std::uint8_t level) {
+  radius = std::clamp(radius, 0, kMaxRadius);
+  Light *light = Find(id);
+  if (light == nullptr) {
+    if (id >= static_cast<int>(_index.size())) { _index.resize(id + 1, kNone); }
+    _index[id] = static_cast<int>(_lights.size());
+    _lights.push_back({id, position, radius, level, false, FieldOfView{}});
+    MarkChanged(_lights.back());
+    return;
+  }
+  if (light->position.x == position.x && light->position.y == position.y && light->radius == radius && light->level == level) { return; }
+  light->position = position;
+  light->radius = radius;
+  light->level = level;
+  MarkChanged(*light);
+}
+
+// the tiles the source has lit are recomputed by the next update. the last source takes the place of the removed one
+void LightMap::RemoveLight(int id) {
+  Light *light = Find(id);
+  if (light == nullptr) { return; }
+  AddDirtyRegion(light->shadow.GetOrigin(), light->shadow.GetRadius());
+  int position = _index[id];
+  _index[id] = kNone;
+  if (position != static_cast<int>(_lights.size()) - 1) {
+    _lights[position] = std::move(_lights.back());
+    _index[_lights[position].id] = position;
+  }
+  _lights.pop_back();
+}
+
+void LightMap::MarkChanged(Light &light) {
+  if (light.isChanged) { return; }
+  light.isChanged = true;
+  _changed.push_back(light.id);
+}
+
+// collect the regions lit by the changed sources before and after the change, then recompute the levels of these regions only
+void LightMap::Update(TerrainMap const &terrain, OccupancyGrid const &grid) {
+  if (_gridRevision != grid.GetRevision()) {
+    for (Light &light : _lights) { MarkChanged(light); }
+    _gridRevision = grid.GetRevision();
+  }
+
+  for (int id : _changed) {
+    Light *light = Find(id);
+    if (light == nullptr || !light->isChanged) { continue; }   // removed since
+    light->isChanged = false;
+    if (!light->shadow.isUpToDate(grid, light->position, light->radius)) {
+      AddDirtyRegion(light->shadow.GetOrigin(), light->shadow.GetRadius());
+      light->shadow.Update(terrain, grid, light->position, light->radius);
+    }
+    AddDirtyRegion(light->position, light->radius);
+  }
+  _changed.clear();
+  if (_dirty.empty()) { return; }
+
+  MergeDirtyRegions();
+  bool isChanged = false;
+  for (Region const &region : _dirty) { isChanged = Relight(region) || isChanged; }
+  _dirty.clear();
+  if (isChanged) { _revision++; }
+}
+
+void LightMap::AddDirtyRegion(Point center, int radius) {
+  Region region{{std::max(center.x - radius, 0), std::max(center.y - radius, 0)},
+                {std::min(center.x + radius, _width - 1), std::min(center.y + radius, _height - 1)}};
+  if (region.min.x > region.max.x || region.min.y > region.max.y) { return; }
+  _dirty.push_back(region);
+}
+
+// replace overlapping regions by their bounding box until no two regions overlap, so no tile is recomputed twice
+// (e.g. the old and the new region of a moving torch)
+void LightMap::MergeDirtyRegions() {
+  auto overlap = [](Region const &a, Region const &b) { return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y; };
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (std::size_t i = 0; i < _dirty.size(); i++) {
+      for (std::size_t j = i + 1; j < _dirty.size(); j++) {
+        if (!overlap(_dirty[i], _dirty[j])) { continue; }
+        _dirty[i] = {{std::min(_dirty[i].min.x, _dirty[j].min.x), std::min(_dirty[i].min.y, _dirty[j].min.y)},
+                     {std::max(_dirty[i].max.x, _dirty[j].max.x), std::max(_dirty[i].max.y, _dirty[j].max.y)}};
+        _dirty[j] = _dirty.back();
+        _dirty.pop_back();
+        merged = true;
+        j = i;    // the grown region may overlap regions checked before
+      }
+    }
+  }
+}
+
+// the level of a tile is the brightest of its ambient light and the light of the sources reaching it. only the sources whose radius
+// overlaps the region are tested
+bool LightMap::Relight(Region const &region) {
+  _nearby.clear();
+  for (Light const &light : _lights) {
+    if (light.position.x + light.radius >= region.min.x && light.position.x - light.radius <= region.max.x &&
+        light.position.y + light.radius >= region.min.y && light.position.y - light.radius <= region.max.y) { _nearby.push_back(&light); }
+  }
+
+  bool isChanged = false;
+  for (int y = region.min.y; y <= region.max.y; y++) {
+    for (int x = region.min.x; x <= region.max.x; x++) {
+      int const cell = y * _width + x;
+      int level = _ambient[cell];
+      for (Light const *light : _nearby) { level = std::max(level, GetContribution(*light, {x, y})); }
+      if (_levels[cell] != level) {
+        _levels[cell] = static_cast<std::uint8_t>(level);
+        isChanged = true;
+      }
+    }
+  }
+  return isChanged;
+}
+
+// light of a source at a tile: full level at the source, fading linearly to zero just beyond the radius. 0 if the tile is in the shadow
+int LightMap::GetContribution(Light const &light, Point point) {
+  int dx = point.x - light.position.x;
+  int dy = point.y - light.position.y;
+  if (std::abs(dx) > light.radius || std::abs(dy) > light.radius || !light.shadow.isVisible(point)) { return 0; }
+  double distance = std::sqrt(static_cast<double>(dx * dx + dy * dy));
+  return std::max(0, static_cast<int>(light.level * (light.radius + 1 - distance) / (light.radius + 1)));
+}
@@ -0,0 +1,84 @@
+#ifndef LIGHT_MAP_H
+#define LIGHT_MAP_H
+
+#include <cstdint>
+#include <vector>
+#include "point.h"
+#include "field_of_view.h"
+#include "occupancy_grid.h"
+#include "terrain_map.h"
+
+// light level of every tile of the map, one byte per tile from kDarkness (pitch black) to kDaylight
+// a tile is lit by the ambient light of its zone and by the light sources nearby (e.g. the player's torch or glowing loot), whichever
+// is brighter. ambient zones are static. a light source shines up to its radius, fading with the distance, and casts shadows like the
+// field of view. when a source is added, moved, changed or removed, only the tiles within its old and new radius are recomputed
+class LightMap {
+ public:
+  static std::uint8_t constexpr kDaylight = 0xFF;
+  static std::uint8_t constexpr kDarkness = 0x00;
+  static int constexpr kMaxRadius = FieldOfView::kMaxRadius;
+
+  // seed of an ambient zone, e.g. a tile of an illumination event
+  struct Zone {
+    Point seed;
+    std::uint8_t level;
+  };
+
+  // set up the ambient light of a level: each passable tile belongs to the zone with the closest seed (walking distance), opaque tiles
+  // take the level of the first zone reaching them (e.g. the walls of a room). without zones, the whole map is lit by daylight
+  // all light sources are removed
+  void Init(TerrainMap const &terrain, std::vector<Zone> const &zones);
+
+  // add or update a light source. id identifies the source (the slot of the entity carrying the light, i.e. a small non-negative number)
+  // setting an unchanged source costs a table lookup. radius is clamped to kMaxRadius
+  void SetLight(int id, Point position, int radius, std::uint8_t level);
+  void RemoveLight(int id);     // no-op if there is no source with this id
+
+  // recompute the tiles around the sources which have been added, moved, changed or removed since the last update. if a door has been
+  // opened, the shadows of all sources are recomputed
+  void Update(TerrainMap const &terrain, OccupancyGrid const &grid);
+
+  // getters. positions outside the map are dark
+  std::uint8_t GetLevel(Point point) const { return IsOnMap(point) ? _levels[point.y * _width + point.x] : kDarkness; }
+  unsigned int GetRevision() const { return _revision; }   // incremented whenever a light level has changed, e.g. to re-bake a texture
+
+ private:
+  static int constexpr kNone = -1;
+
+  struct Light {
+    int id;
+    Point position;
+    int radius;
+    std::uint8_t level;
+    bool isChanged;       // listed in _changed
+    FieldOfView shadow;   // tiles reached by the light
+  };
+  // rectangle of tiles, corners included
+  struct Region {
+    Point min;
+    Point max;
+  };
+
+  bool IsOnMap(Point point) const { return point.x >= 0 && point.y >= 0 && point.x < _width && point.y < _height; }
+  Light *Find(int id) { return id >= 0 && id < static_cast<int>(_index.size()) && _index[id] != kNone ? &_lights[_index[id]] : nullptr; }
+  void MarkChanged(Light &light);
+  void AddDirtyRegion(Point center, int radius);
+  void MergeDirtyRegions();
+  bool Relight(Region const &region);   // returns true if a level has changed
+  static int GetContribution(Light const &light, Point point);
+
+  int _width{0};
+  int _height{0};
+  std::vector<std::uint8_t> _ambient{};   // per tile, indexed by y * width + x
+  std::vector<std::uint8_t> _levels{};
+  std::vector<Light> _lights{};           // dense, in no particular order
+  std::vector<int> _index{};              // by id: position in _lights or kNone
+  std::vector<int> _changed{};            // ids of the sources added or changed since the last update
+  std::vector<Region> _dirty{};           // regions to be recomputed by the next update
+  std::vector<Light const *> _nearby{};   // sources reaching the region being recomputed
+  std::vector<int> _queue{};              // BFS queue of Init
+  unsigned int _gridRevision{0};          // revision of the occupancy grid the shadows were computed for
+  unsigned int _revision{0};
+};
+
+#endif
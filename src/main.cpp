@@ -1,20 +1,64 @@
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
-#include "controller.h"
+#include <random>
+#include <string>
 #include "game.h"
-#include "renderer.h"
+#include "input_log.h"
+#include "message_log.h"
+#include "sdl_controller.h"
+#include "sdl_renderer.h"
 
-int main() {
-  constexpr std::size_t kFramesPerSecond{60};
-  constexpr std::size_t kMsPerFrame{1000 / kFramesPerSecond};
+int main(int argc, char *argv[]) {
+  constexpr std::size_t kTicksPerSecond{60};
+  constexpr std::size_t kMsPerTick{1000 / kTicksPerSecond};
   constexpr std::size_t kScreenWidth{1020};
   constexpr std::size_t kScreenHeight{780};
+  constexpr std::size_t kPanelHeight{160};
   constexpr std::size_t kGridWidth{51};
   constexpr std::size_t kGridHeight{39};  
 
-  Renderer renderer(kScreenWidth, kScreenHeight, kGridWidth, kGridHeight);
-  Controller controller;
-  Game game(kGridWidth, kGridHeight);
-  game.Run(controller, renderer, kMsPerFrame);
+  // simulation speed, e.g. for automated testing: "--speed <n>" runs the game n times faster, "--turbo" as fast as possible
+  // "--seed <n>" replays the random rolls of an earlier game
+  // "--record <file>" records the session's input, "--replay <file>" plays a recorded session back (e.g. with --turbo)
+  // "--log <file>" appends the game messages to this file instead of ellesmere.log
+  int speed{1};
+  std::string recordpath;
+  std::string replaypath;
+  std::string logpath{"ellesmere.log"};
+  std::uint64_t seed = (static_cast<std::uint64_t>(std::random_device{}()) << 32) | std::random_device{}();
+  for (int i = 1; i < argc; i++) {
+    if (std::strcmp(argv[i], "--turbo") == 0) { speed = SimulationClock::kUncapped; }
+    else if (std::strcmp(argv[i], "--speed") == 0 && i + 1 < argc && std::atoi(argv[i + 1]) > 0) { speed = std::atoi(argv[++i]); }
+    else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) { seed = std::strtoull(argv[++i], nullptr, 10); }
+    else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) { recordpath = argv[++i]; }
+    else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) { replaypath = argv[++i]; }
+    else if (std::strcmp(argv[i], "--log") == 0 && i + 1 < argc) { logpath = argv[++i]; }
+    else {
+      std::cerr << "usage: " << argv[0] << " [--speed <n> | --turbo] [--seed <n>] [--record <file>] [--replay <file>] [--log <file>]" << std::endl;
+      return 1;
+    }
+  }
+
+  InputLog replay;
+  if (!replaypath.empty()) {
+    if (!replay.Load(replaypath)) { return 1; }
+    seed = replay.GetSeed();
+  }
+
+  SdlRenderer renderer(kScreenWidth, kScreenHeight, kGridWidth, kGridHeight, kPanelHeight);
+  SdlController controller;
+  std::cout << "Seed: " << seed << std::endl;
+  // game messages are written to the console & the log file by a background thread
+  MessageLog messages;
+  messages.Start(true, logpath);
+  Game game(seed, messages);
+  InputLog recording;
+  if (!recordpath.empty()) { game.StartRecording(recording); }
+  if (!replaypath.empty()) { game.StartReplay(replay); }
+  game.Run(controller, renderer, kMsPerTick, speed);
+  messages.Stop();
+  if (!recordpath.empty() && !recording.Save(recordpath)) { std::cerr << "Error: Input log '" << recordpath << "' could not be written!" << std::endl; }
   std::cout << "Game has terminated successfully!\n";
   return 0;
-}
\ No newline at end of file
+}
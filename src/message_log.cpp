@@ -0,0 +1,113 @@
+#include "message_log.h"
+
+#include <algorithm>
+#include <iostream>
+
+// start the background thread and open the sinks
+bool MessageLog::Start(bool console, std::string const &logpath) {
+  if (_running) { return true; }
+  _console = console;
+  if (!logpath.empty()) {
+    _file.open(logpath, std::ios::out | std::ios::app);
+    if (!_file) { std::cerr << "Error: Log file '" << logpath << "' could not be opened!" << std::endl; }
+  }
+  _stop = false;
+  _running = true;
+  _thread = std::thread(&MessageLog::Drain, this);
+  return _file.is_open() || logpath.empty();
+}
+
+// write all pending lines and stop the background thread. an unfinished line is written as well
+void MessageLog::Stop() {
+  if (!_running) { return; }
+  if (!_line.empty()) { Commit(); }
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _wake.notify_one();
+  _thread.join();
+  _running = false;
+  if (_file.is_open()) { _file.close(); }
+}
+
+// collect a single character
+MessageLog::int_type MessageLog::overflow(int_type c) {
+  if (traits_type::eq_int_type(c, traits_type::eof())) { return traits_type::not_eof(c); }
+  if (traits_type::to_char_type(c) == '\n') { Commit(); }
+  else { _line.push_back(traits_type::to_char_type(c)); }
+  return c;
+}
+
+// collect a string, which may contain several lines
+std::streamsize MessageLog::xsputn(char const *s, std::streamsize n) {
+  char const *end = s + n;
+  while (s != end) {
+    char const *newline = std::find(s, end, '\n');
+    _line.append(s, newline);
+    if (newline == end) { break; }
+    Commit();
+    s = newline + 1;
+  }
+  return n;
+}
+
+// end the current line. the background thread is only woken up if the ring buffer has been empty, i.e. once per batch of lines
+// if the ring buffer is full, block until the background thread has made room
+void MessageLog::Commit() {
+  _history.push_back(_line);
+  _lines++;
+  if (_history.size() > kHistorySize) { _history.pop_front(); }
+
+  if (!_running) {
+    _line.clear();
+    return;
+  }
+  std::size_t head = _head.load(std::memory_order_relaxed);
+  std::size_t tail = _tail.load(std::memory_order_acquire);
+  if (head - tail == kCapacity) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _space.wait(lock, [this, head] { return head - _tail.load(std::memory_order_acquire) < kCapacity; });
+    tail = _tail.load(std::memory_order_acquire);
+  }
+  _ring[head % kCapacity] = std::move(_line);
+  _line.clear();
+  _head.store(head + 1, std::memory_order_release);
+
+  // taking the lock makes sure the background thread is either waiting or hasn't checked for pending lines yet, so it can't miss the notification
+  if (head == tail) {
+    { std::lock_guard<std::mutex> lock(_mutex); }
+    _wake.notify_one();
+  }
+}
+
+// background thread: sleep until lines are pending, then write them in one batch
+void MessageLog::Drain() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  bool stop = false;
+  while (!stop) {
+    _wake.wait_for(lock, kDrainInterval, [this] { return _stop || _head.load(std::memory_order_acquire) != _tail.load(std::memory_order_relaxed); });
+    stop = _stop;
+    lock.unlock();
+    WritePending();
+    lock.lock();
+    _space.notify_one();    // the game may be waiting for room in the ring buffer
+  }
+}
+
+// write all lines of the ring buffer, flushing the sinks once per batch
+bool MessageLog::WritePending() {
+  std::size_t tail = _tail.load(std::memory_order_relaxed);
+  std::size_t head = _head.load(std::memory_order_acquire);
+  if (tail == head) { return false; }
+  for (; tail != head; tail++) {
+    std::string &line = _ring[tail % kCapacity];
+    if (_console) { std::cout << line << '\n'; }
+    if (_file.is_open()) { _file << line << '\n'; }
+    line.clear();
+    _tail.store(tail + 1, std::memory_order_release);
+  }
+  if (_console) { std::cout.flush(); }
+  if (_file.is_open()) { _file.flush(); }
+  return true;
+}
@@ -0,0 +1,80 @@
+#ifndef MESSAGE_LOG_H
+#define MESSAGE_LOG_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+// game messages (fights, dialogue, inventory, ...). the game writes to Stream() like to std::cout, but nothing is written or flushed
+// on the simulation thread: complete lines are handed to a background thread through a lock-free single producer / single consumer
+// ring buffer, and the background thread writes them in batches to the console and the log file. std::endl only ends the line
+// the last kHistorySize lines are kept for display in the game window (e.g. a message panel of the renderer)
+// Stream(), Start(), Stop() and GetHistory() must be used by one thread (the game loop). without Start(), lines only go to the history
+class MessageLog : private std::streambuf {
+ public:
+  static constexpr std::size_t kHistorySize = 64;
+
+  MessageLog() : _stream(this) {}
+  ~MessageLog() { Stop(); }
+
+  MessageLog(const MessageLog &source) = delete;
+  MessageLog &operator=(const MessageLog &source) = delete;
+
+  std::ostream &Stream() { return _stream; }
+  std::deque<std::string> const &GetHistory() const { return _history; }
+  // number of lines written so far. the last line of the history is line GetLineCount() - 1
+  std::uint64_t GetLineCount() const { return _lines; }
+
+  // start the background thread. console: write to std::cout, logpath: append to this file (none if empty)
+  bool Start(bool console, std::string const &logpath);
+  // write all pending lines and stop the background thread
+  void Stop();
+
+ private:
+  // capacity of the ring buffer (power of two). if the console can't keep up, the game blocks until there is room instead of dropping lines
+  static constexpr std::size_t kCapacity = 1024;
+  static_assert((kCapacity & (kCapacity - 1)) == 0, "the ring buffer indices wrap around");
+  // the background thread wakes up at least this often
+  static constexpr std::chrono::milliseconds kDrainInterval{100};
+
+  // std::streambuf: collect characters up to the end of the line
+  int_type overflow(int_type c) override;
+  std::streamsize xsputn(char const *s, std::streamsize n) override;
+  int sync() override { return 0; }
+
+  void Commit();              // end the current line: add it to the history & the ring buffer
+  void Drain();               // background thread
+  bool WritePending();        // write all lines of the ring buffer to the sinks. returns false if there were none
+
+  std::ostream _stream;
+  std::string _line{};
+  std::deque<std::string> _history{};
+  std::uint64_t _lines{0};
+
+  // ring buffer. _head is only written by the producer, _tail only by the consumer; both only ever increase
+  std::array<std::string, kCapacity> _ring{};
+  std::atomic<std::size_t> _head{0};
+  std::atomic<std::size_t> _tail{0};
+
+  // background thread & sinks
+  std::thread _thread{};
+  std::mutex _mutex{};
+  std::condition_variable _wake{};     // lines are pending (or stop)
+  std::condition_variable _space{};    // the background thread has written a batch, i.e. there is room in the ring buffer
+  bool _running{false};
+  bool _stop{false};          // guarded by _mutex
+  bool _console{false};
+  std::ofstream _file{};
+};
+
+#endif
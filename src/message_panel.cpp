@@ -0,0 +1,79 @@
+#include "message_panel.h"
+
+#include <algorithm>
+
+MessagePanel::MessagePanel(SDL_Renderer *renderer, SDL_Rect area, int scale) : _atlas(renderer), _area(area) {
+  _glyphSize = GlyphAtlas::kGlyphSize * scale;
+  _lineHeight = _glyphSize + 2 * scale;
+  _padding = 4 * scale;
+  _columns = std::max(1, (_area.w - 2 * _padding) / _glyphSize);
+}
+
+// draw the background and as many of the latest lines as fit into the panel, oldest on top
+void MessagePanel::Render(SDL_Renderer *renderer, MessageLog const &messages) {
+  UpdateRuns(messages);
+
+  SDL_SetRenderDrawColor(renderer, 0x11, 0x11, 0x11, 0xFF);
+  SDL_RenderFillRect(renderer, &_area);
+
+  // count the rows of the latest runs from the bottom up, until the panel is full
+  int maxRows = std::max(1, (_area.h - 2 * _padding) / _lineHeight);
+  int rows = 0;
+  std::size_t first = _runs.size();
+  while (first > 0 && rows < maxRows) { rows += _runs[--first].rows; }
+
+  // the first run may be cut off at the top, its upper rows are skipped
+  int top = _area.y + _area.h - _padding - rows * _lineHeight;
+  int minY = _area.y + _padding;
+  SDL_SetTextureColorMod(_atlas.GetTexture(), 0xDD, 0xDD, 0xDD);
+  for (std::size_t i = first; i < _runs.size(); i++) {
+    for (Glyph const &glyph : _runs[i].glyphs) {
+      SDL_Rect target{_area.x + _padding + glyph.target.x, top + glyph.target.y, glyph.target.w, glyph.target.h};
+      if (target.y < minY) { continue; }
+      SDL_RenderCopy(renderer, _atlas.GetTexture(), &glyph.source, &target);
+    }
+    top += _runs[i].rows * _lineHeight;
+  }
+}
+
+// align the cached runs with the history: drop the runs of lines which have left the history, lay out the new ones
+void MessagePanel::UpdateRuns(MessageLog const &messages) {
+  std::deque<std::string> const &history = messages.GetHistory();
+  std::uint64_t first = messages.GetLineCount() - history.size();
+  while (!_runs.empty() && _firstLine < first) {
+    _runs.pop_front();
+    _firstLine++;
+  }
+  if (_runs.empty()) { _firstLine = first; }
+  for (std::size_t i = _firstLine + _runs.size() - first; i < history.size(); i++) { _runs.push_back(Layout(history[i])); }
+}
+
+// word-wrap the line to the panel's width. words longer than a row are split
+MessagePanel::GlyphRun MessagePanel::Layout(std::string const &line) const {
+  GlyphRun run{{}, 1};
+  int column = 0;
+  std::size_t pos = 0;
+  while (pos < line.size()) {
+    if (line[pos] == ' ') {
+      column++;
+      pos++;
+      continue;
+    }
+    std::size_t end = std::min(line.find(' ', pos), line.size());
+    int length = static_cast<int>(end - pos);
+    if (column > 0 && column + length > _columns) {
+      run.rows++;
+      column = 0;
+    }
+    for (; pos < end; pos++) {
+      if (column == _columns) {
+        run.rows++;
+        column = 0;
+      }
+      SDL_Rect target{column * _glyphSize, (run.rows - 1) * _lineHeight, _glyphSize, _glyphSize};
+      run.glyphs.push_back({_atlas.GetGlyph(line[pos]), target});
+      column++;
+    }
+  }
+  return run;
+}
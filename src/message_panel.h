@@ -0,0 +1,47 @@
+#ifndef MESSAGE_PANEL_H
+#define MESSAGE_PANEL_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include "SDL.h"
+#include "glyph_atlas.h"
+#include "message_log.h"
+
+// in-window message panel: shows the latest lines of the message log, word-wrapped to the width of the panel
+// each line is laid out once into a glyph run (atlas & screen rectangle of each glyph), which is cached as long as the line is in the
+// history. redrawing an unchanged line only copies its glyphs from the atlas; all copies use the same texture, so SDL batches them
+class MessagePanel {
+ public:
+  // area: screen rectangle of the panel, scale: size of a glyph in multiples of the font's pixel size
+  MessagePanel(SDL_Renderer *renderer, SDL_Rect area, int scale);
+
+  void Render(SDL_Renderer *renderer, MessageLog const &messages);
+
+ private:
+  struct Glyph {
+    SDL_Rect source;      // in the atlas
+    SDL_Rect target;      // relative to the top left corner of the run
+  };
+  struct GlyphRun {
+    std::vector<Glyph> glyphs;
+    int rows;
+  };
+
+  void UpdateRuns(MessageLog const &messages);   // lay out the lines which have been added to the history since the last frame
+  GlyphRun Layout(std::string const &line) const;
+
+  GlyphAtlas _atlas;
+  SDL_Rect _area;
+  int _glyphSize;
+  int _lineHeight;
+  int _padding;
+  int _columns;           // characters per row
+
+  // glyph runs of the history's lines, _runs.front() is line _firstLine of the message log
+  std::deque<GlyphRun> _runs{};
+  std::uint64_t _firstLine{0};
+};
+
+#endif
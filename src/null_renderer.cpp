@@ -0,0 +1,6 @@
+#include "null_renderer.h"
+
+void NullRenderer::Render(Player & /*player*/, EntityStore const & /*entities*/, FieldOfView const & /*fov*/, LightMap const & /*lights*/,
+                          TerrainMap const & /*terrain*/, MessageLog const & /*messages*/) {
+  ++_frames;
+}
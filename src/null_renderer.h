@@ -0,0 +1,19 @@
+#ifndef NULL_RENDERER_H
+#define NULL_RENDERER_H
+
+#include "renderer.h"
+
+// renderer for runs without a display: draws nothing, only counts the frames
+class NullRenderer : public Renderer {
+ public:
+  void Render(Player &player, EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, TerrainMap const &terrain,
+              MessageLog const &messages) override;
+  void UpdateWindowTitle(int /*fps*/) override {}
+
+  long GetFrameCount() const { return _frames; }
+
+ private:
+  long _frames{0};
+};
+
+#endif
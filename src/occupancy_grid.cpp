@@ -0,0 +1,87 @@
+#include "occupancy_grid.h"
+#include "entity.h"
+
+// set size, clear all tiles and mark impassable terrain
+void OccupancyGrid::Init(TerrainMap const &terrain) {
+  _width = terrain.GetWidth();
+  _height = terrain.GetHeight();
+  _tiles.assign(_width * _height, kNone);
+  _heads.assign(_width * _height, kEnd);
+  for (int y = 0; y < _height; y++) {
+    for (int x = 0; x < _width; x++) {
+      if (!terrain.IsPassable({x, y})) { _tiles[y * _width + x] = kWall; }
+    }
+  }
+  _nodes.clear();
+  _freeNodes = kEnd;
+  ++_revision;
+}
+
+// add an entity to the index
+void OccupancyGrid::Register(Entity *entity, Layer layer, EntityHandle owner) {
+  if (entity->_grid != nullptr) { entity->_grid->Unregister(entity); }
+
+  // reuse a free node if possible
+  int node = _freeNodes;
+  if (node != kEnd) { 
+    _freeNodes = _nodes[node].next; 
+  } else {
+    node = static_cast<int>(_nodes.size());
+    _nodes.emplace_back();
+  }
+  _nodes[node] = {entity, owner, kEnd, kEnd, layer};
+  entity->_grid = this;
+  entity->_gridNode = node;
+  Link(node, entity->GetPosition());
+}
+
+// remove an entity from the index
+void OccupancyGrid::Unregister(Entity *entity) {
+  int node = entity->_gridNode;
+  Unlink(node);
+  _nodes[node].entity = nullptr;
+  _nodes[node].next = _freeNodes;
+  _freeNodes = node;
+  entity->_grid = nullptr;
+}
+
+// move an entity to a new tile
+void OccupancyGrid::Move(Entity *entity, Point to) {
+  int node = entity->_gridNode;
+  Unlink(node);
+  Link(node, to);
+}
+
+// add node to the list of the tile at point
+void OccupancyGrid::Link(int node, Point point) {
+  // entities outside the map are kept registered, but are not linked to any tile
+  if (!IsOnMap(point)) { return; }
+  int tile = point.y * _width + point.x;
+  _nodes[node].tile = tile;
+  _nodes[node].next = _heads[tile];
+  _heads[tile] = node;
+  UpdateFlags(tile);
+}
+
+// remove node from the list of its tile
+void OccupancyGrid::Unlink(int node) {
+  int tile = _nodes[node].tile;
+  if (tile == kEnd) { return; }
+
+  // lists are short (rarely more than one entity per tile), so a linear search is fine
+  int *link = &_heads[tile];
+  while (*link != node) { link = &_nodes[*link].next; }
+  *link = _nodes[node].next;
+
+  _nodes[node].tile = kEnd;
+  _nodes[node].next = kEnd;
+  UpdateFlags(tile);
+}
+
+// recalculate the occupancy flags of a tile from the layers of its entities (walls are part of the terrain and are kept)
+void OccupancyGrid::UpdateFlags(int tile) {
+  std::uint8_t flags = _tiles[tile] & kWall;
+  for (int n = _heads[tile]; n != kEnd; n = _nodes[n].next) { flags |= _nodes[n].layer; }
+  if ((flags & kStatic) != (_tiles[tile] & kStatic)) { ++_revision; }
+  _tiles[tile] = flags;
+}
@@ -0,0 +1,77 @@
+#ifndef OCCUPANCY_GRID_H
+#define OCCUPANCY_GRID_H
+
+#include <cstdint>
+#include <vector>
+#include "point.h"
+#include "registry.h"
+#include "terrain_map.h"
+
+class Entity;
+
+// flat map of all entities on the game map, row-major (index = y * width + x). 
+// serves two purposes: 
+// - per-tile entity index: every registered entity is linked into the list of the tile it stands on, so finding the object at a position is O(1)
+// - occupancy flags: one byte per tile, combining impassable terrain (kWall) with the layers of all entities on that tile (used for path finding and fast collision checks)
+// entities keep the index up to date themselves: see Entity::SetPosition
+class OccupancyGrid {
+ public:
+  // layers a tile can be occupied by. since layers are bit flags, a tile can hold several of them at once
+  enum Layer : std::uint8_t { kNone = 0, kWall = 1, kDoor = 2, kNPC = 4, kChest = 8, kOpponent = 16, kPlayer = 32, kTreasure = 64 };
+
+  // layers that only change on rare occasions (e.g. if a door opens). used as obstacles for path finding
+  static std::uint8_t constexpr kStatic = kWall | kDoor | kNPC;
+  // layers that block the movement of opponents
+  static std::uint8_t constexpr kBlocking = kWall | kDoor | kNPC | kChest | kOpponent;
+
+  // set size, clear all tiles and mark impassable terrain as kWall. to be called before any entity is registered
+  void Init(TerrainMap const &terrain);
+
+  // add / remove an entity to / from the index. "owner" is the handle of the game object the entity represents (e.g. the door a door wing belongs to)
+  void Register(Entity *entity, Layer layer, EntityHandle owner);
+  void Unregister(Entity *entity);
+  void Move(Entity *entity, Point to);   // called by Entity::SetPosition
+
+  // returns the owner of the first entity at point which is on one of the given layers (or an invalid handle). resolve it with the registry of the layer
+  EntityHandle Find(Point point, std::uint8_t layers) const {
+    for (int n = Head(point); n != kEnd; n = _nodes[n].next) {
+      if (_nodes[n].layer & layers) { return _nodes[n].owner; }
+    }
+    return {};
+  }
+
+  // true if any of the given layers occupies the tile. positions outside the map are always blocked
+  bool IsBlocked(Point point, std::uint8_t layers) const { return !IsOnMap(point) || (_tiles[point.y * _width + point.x] & layers) != 0; }
+  bool IsOnMap(Point point) const { return point.x >= 0 && point.y >= 0 && point.x < _width && point.y < _height; }
+
+  // getters
+  int GetWidth() const { return _width; }
+  int GetHeight() const { return _height; }
+  unsigned int GetRevision() const { return _revision; }   // incremented whenever one of the static layers changes
+
+ private:
+  // list node of the per-tile index. nodes are pooled, "next" links nodes on the same tile (or free nodes)
+  struct Node {
+    Entity *entity;
+    EntityHandle owner;
+    int next;
+    int tile;       // kEnd if the entity is not on the map
+    Layer layer;
+  };
+  static int constexpr kEnd = -1;
+
+  int Head(Point point) const { return IsOnMap(point) ? _heads[point.y * _width + point.x] : kEnd; }
+  void Link(int node, Point point);
+  void Unlink(int node);
+  void UpdateFlags(int tile);
+
+  int _width{0};
+  int _height{0};
+  unsigned int _revision{0};
+  std::vector<std::uint8_t> _tiles{};   // occupancy flags
+  std::vector<int> _heads{};            // first node per tile
+  std::vector<Node> _nodes{};           // node pool
+  int _freeNodes{kEnd};
+};
+
+#endif
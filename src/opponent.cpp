@@ -1,13 +1,12 @@
 #include <random>
-#include "SDL.h"
 #include "opponent.h"
 #include <iostream>
 
 
 // try to find the next movement step of this instance
-SDL_Point Opponent::tryMove(SDL_Point nextStepTowardPlayer, SDL_Point playerPosition) 
+Point Opponent::tryMove(Point nextStepTowardPlayer, Point playerPosition, bool playerInSight) 
 {        
-  UpdateStateMachine(nextStepTowardPlayer, playerPosition);
+  UpdateStateMachine(nextStepTowardPlayer, playerPosition, playerInSight);
 
   switch (_state) {
     case State::kDead:   
@@ -22,9 +21,9 @@ SDL_Point Opponent::tryMove(SDL_Point nextStepTowardPlayer, SDL_Point playerPosi
 }
 
 // simple random movement
-SDL_Point Opponent::BrownianMotion()
+Point Opponent::BrownianMotion()
 { 
-  int direction = rand() % 5;       // using std::rand() only as proof of concept. of course other engines might be better suited
+  int direction = _rng.Roll(5);
   int x = this->GetPosition().x;
   int y = this->GetPosition().y;
   // calculate requested move
@@ -45,19 +44,19 @@ SDL_Point Opponent::BrownianMotion()
       break;
   }      
 
-  SDL_Point requestedPosition{x,y};
+  Point requestedPosition{x,y};
   return requestedPosition;     
 };
 
 // helper function: euclidean distance
-int Opponent::CalculateDistance(SDL_Point start, SDL_Point target) {
+int Opponent::CalculateDistance(Point start, Point target) {
     int dx = start.x - target.x;
     int dy = start.y - target.y;
     return static_cast<int>(sqrt(pow(dx,2.0)+pow(dy,2.0)));
 }
 
 // state machine definition
-void Opponent::UpdateStateMachine(SDL_Point nextStepTowardPlayer, SDL_Point playerPosition) {
+void Opponent::UpdateStateMachine(Point nextStepTowardPlayer, Point playerPosition, bool playerInSight) {
 
   if (!alive) { 
     if (_state != State::kDead) { _state = State::kDead; }
@@ -65,14 +64,14 @@ void Opponent::UpdateStateMachine(SDL_Point nextStepTowardPlayer, SDL_Point play
   } 
   // first, calculate distance to player & make perception roll
   int distToPlayer = CalculateDistance(playerPosition, this->GetPosition());
-  int perceptionRoll = rand() % _perception;
+  int perceptionRoll = _rng.Roll(_perception);
 
   // if step is equal to current position, no valid path to player exists. stop moving.
   if (nextStepTowardPlayer.x == this->GetPosition().x && nextStepTowardPlayer.y == this->GetPosition().y) { 
     _state = State::kIdle;
   }
-  // if player was spotted, engage
-  else if (perceptionRoll >= distToPlayer) {
+  // if player was spotted, engage. the player can't be spotted through walls & closed doors
+  else if (playerInSight && perceptionRoll >= distToPlayer) {
     _state = State::kEngaging;
   } 
   // if player was lost (dist > max perception), start searching 
@@ -89,7 +88,7 @@ void Opponent::UpdateStateMachine(SDL_Point nextStepTowardPlayer, SDL_Point play
 // place random item on the map if defeated
 std::unique_ptr<InventoryItem> Opponent::DropLoot() 
 {
-  int lootRoll = rand() % 5;
+  int lootRoll = _rng.Roll(5);
       
   switch (lootRoll) {
     case 0 ... 1: {
@@ -115,7 +114,7 @@ std::unique_ptr<InventoryItem> Opponent::DropLoot()
     case 4: {
       std::unique_ptr<InventoryItem> item = std::make_unique<InventoryItem>();
       item->name = "Gold Coin";
-      item->number = rand() % 5 + 1;
+      item->number = _rng.Roll(5) + 1;
       return item;
     }
   }
@@ -3,11 +3,11 @@
 
 #include <vector>
 #include <math.h>
-#include "SDL.h"
+#include "point.h"
 #include "entity.h"
 #include "combattant.h"
+#include "pcg32.h"
 
-#include <random>
 #include <string>
 #include <memory>
 
@@ -19,12 +19,17 @@ class Opponent : public Entity, public Combattant {
     enum class State { kDead, kIdle, kSearching, kEngaging };
 
     // constructor
-    Opponent(int x, int y, Type type) : Entity(x, y, type)  { InitStats(8, 6, 6, 1, 15, Faction::kHostile, "Orc"); }   
+    Opponent(EntityStore &store, int x, int y, Type type) : Entity(store, x, y, type)  { InitStats(8, 6, 6, 1, 15, Faction::kHostile, "Orc"); }   
+    Opponent(EntityStore &store, int x, int y, Type type, int maxHP, int AT, int DE, int AG, int XP, std::string name) : Entity(store, x, y, type)  { InitStats(maxHP, AT, DE, AG, XP, Faction::kHostile, name); }
+
+    // random rolls (movement, perception, loot) are drawn from the opponent's own stream
+    void SetRandomStream(Pcg32 const &rng) { _rng = rng; }
 
     // movement  
-    SDL_Point BrownianMotion();
-    SDL_Point tryMove(SDL_Point nextStepTowardPlayer, SDL_Point playerPosition); 
-    void UpdateStateMachine(SDL_Point nextStepTowardPlayer, SDL_Point playerPosition);
+    Point BrownianMotion();
+    // playerInSight: the opponent is in the player's field of view (and vice versa), i.e. it can spot the player
+    Point tryMove(Point nextStepTowardPlayer, Point playerPosition, bool playerInSight); 
+    void UpdateStateMachine(Point nextStepTowardPlayer, Point playerPosition, bool playerInSight);
 
     // combat - definition of virtual functions of class Combattant
     int GetAttackValue () {return GetAttackBase();};
@@ -37,9 +42,10 @@ class Opponent : public Entity, public Combattant {
   private:
     State _state{State::kIdle};   // NPC state machine    
     int _perception{10};          // detection threshold for distance to player
+    Pcg32 _rng{};
 
     // helper function to check if instance has detected the player      
-    int CalculateDistance(SDL_Point start, SDL_Point target);  
+    int CalculateDistance(Point start, Point target);  
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,43 @@
+#ifndef PCG32_H
+#define PCG32_H
+
+#include <cstdint>
+
+// PCG32 (XSH RR) random number generator: 64 bit state, 32 bit output, 2^63 independent streams per seed.
+// the game seeds one stream per purpose (fights, every opponent), so a run is reproducible from its seed alone and 
+// parallel games (see simulate.cpp) don't share any generator state
+// satisfies UniformRandomBitGenerator, i.e. can be used with the <random> distributions as well
+class Pcg32 {
+ public:
+  using result_type = std::uint32_t;
+
+  Pcg32() : Pcg32(0, 0) {}
+  Pcg32(std::uint64_t seed, std::uint64_t stream) : _increment((stream << 1u) | 1u) {
+    (*this)();
+    _state += seed;
+    (*this)();
+  }
+
+  result_type operator()() {
+    std::uint64_t old = _state;
+    _state = old * 6364136223846793005ULL + _increment;
+    std::uint32_t xorshifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+    std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59u);
+    return (xorshifted >> rotation) | (xorshifted << ((0u - rotation) & 31u));
+  }
+
+  // uniformly distributed integer in [0, n), replaces rand() % n. returns 0 for n <= 0
+  int Roll(int n) {
+    if (n <= 0) { return 0; }
+    return static_cast<int>((static_cast<std::uint64_t>((*this)()) * static_cast<std::uint32_t>(n)) >> 32);
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return UINT32_MAX; }
+
+ private:
+  std::uint64_t _state{0};
+  std::uint64_t _increment;
+};
+
+#endif
@@ -1,9 +1,10 @@
 #include "player.h"
 #include <iostream>
 #include <algorithm>
+#include <limits>
 
 // calculate new player position based on user input
-SDL_Point Player::tryMove() 
+Point Player::tryMove() 
 { 
   // temporary position
   int x = this->GetPosition().x;
@@ -32,7 +33,7 @@ SDL_Point Player::tryMove()
   // reset direction after moving
   direction = Direction::kNone;
 
-  SDL_Point requestedPosition{x,y};
+  Point requestedPosition{x,y};
   return requestedPosition;
 }
 
@@ -64,7 +65,7 @@ void Player::receiveItem(std::unique_ptr<InventoryItem> item, bool SuppressText)
    
   auto plural = (item->number == 1) ? "" : "s";
 
-  if (!SuppressText) { std::cout << std::to_string(item->number) << " " << item->name << plural << " added to inventory" << std::endl; }
+  if (!SuppressText) { Messages() << std::to_string(item->number) << " " << item->name << plural << " added to inventory" << std::endl; }
 
   // if the item is not already in inventory, move it there
   if (!alreadyInInventory) {
@@ -77,21 +78,21 @@ void Player::receiveItem(std::unique_ptr<InventoryItem> item, bool SuppressText)
 void Player::DisplayInventory() {
 
   if (_inventory.empty()) {
-    std::cout << "---------------" << std::endl;
-    std::cout << "Your inventory is empty" << std::endl;
+    Messages() << "---------------" << std::endl;
+    Messages() << "Your inventory is empty" << std::endl;
   }
   else {
     int i{0};
-    std::cout << "---------------" << std::endl;
-    std::cout << "Your inventory contains:" << std::endl;
-    std::cout << "('*' indicates equipped items)" << std::endl;
+    Messages() << "---------------" << std::endl;
+    Messages() << "Your inventory contains:" << std::endl;
+    Messages() << "('*' indicates equipped items)" << std::endl;
     for (std::unique_ptr<InventoryItem> &item : _inventory) {
       i++;
       auto plural = (item->number == 1) ? "" : "s";          
       auto marker = ((item.get() == _equipped_weapon) || (item.get() == _equipped_armor)) ? " *" : "";
-      std::cout << "#" << i << ": " << item->name << plural << " (" << item->number << ")" << marker << std::endl;
+      Messages() << "#" << i << ": " << item->name << plural << " (" << item->number << ")" << marker << std::endl;
     }
-    std::cout << "Press item number to equip or use" << std::endl;
+    Messages() << "Press item number to equip or use" << std::endl;
   }  
 }
   
@@ -105,24 +106,24 @@ void Player::SelectItem(int i, bool suppressText) {
   if (item->isWeapon) { 
     _equipped_weapon = item; 
     if (!suppressText) { 
-      std::cout << "---------------" << std::endl;
-      std::cout << _equipped_weapon->name << " equipped as primary weapon" << std::endl; 
+      Messages() << "---------------" << std::endl;
+      Messages() << _equipped_weapon->name << " equipped as primary weapon" << std::endl; 
     }
     return; 
   }
   if (item->isArmor) { 
     _equipped_armor = item; 
     if (!suppressText) { 
-      std::cout << "---------------" << std::endl;
-      std::cout << _equipped_armor->name << " equipped as armor" << std::endl; 
+      Messages() << "---------------" << std::endl;
+      Messages() << _equipped_armor->name << " equipped as armor" << std::endl; 
     }
     return; 
   }
   if (item->healing > 0) { 
     Heal(item->healing);
     if (!suppressText) { 
-      std::cout << "---------------" << std::endl;
-      std::cout << "You healed " << item->healing << " hit points" << std::endl; 
+      Messages() << "---------------" << std::endl;
+      Messages() << "You healed " << item->healing << " hit points" << std::endl; 
     }
     if ( item->isSingleUseItem ) { DeleteFromInventory(item, 1); }      
     return; 
@@ -137,8 +138,8 @@ void Player::SelectItem(int i, bool suppressText) {
   }
 
   if (!suppressText) { 
-    std::cout << "---------------" << std::endl;
-    std::cout << "Item can not be equipped or used" << std::endl; 
+    Messages() << "---------------" << std::endl;
+    Messages() << "Item can not be equipped or used" << std::endl; 
   }
 }
 
@@ -162,14 +163,14 @@ void Player::DeleteFromInventory(InventoryItem *toDelete, int number) {
 // display player status
 void Player::DisplayStatus() {
   std::string status = (GetHP() < GetMaxHP()) ? "wounded" : "in perfect health";
-  std::cout << "---------------" << std::endl;
-  std::cout << "You are " << status << " (Hitpoints: " << GetHP() << "/" << GetMaxHP() << ")" << std::endl; 
+  Messages() << "---------------" << std::endl;
+  Messages() << "You are " << status << " (Hitpoints: " << GetHP() << "/" << GetMaxHP() << ")" << std::endl; 
 }
 
 // add xp to player's total experience
 void Player::ReceiveXP (int xp) { 
   _XP += xp;
-  std::cout << "You receive " << xp << " experience points (Total: " << _XP << ")" << std::endl;
+  Messages() << "You receive " << xp << " experience points (Total: " << _XP << ")" << std::endl;
 }
 
 // redefinition of virtual function of class combattant
@@ -184,6 +185,26 @@ int Player::GetDefenseValue () {
   return GetDefenseBase() + _equipped_armor->defense_mod;
 };
 
+// check if the player is allowed to move
+bool Player::isMyTurnToMove() {
+  ++_turnCounterMove;
+  ++_turnCounterAttack;
+  if (_turnCounterMove >= GetMoveInterval()) {
+    _turnCounterMove = 0;
+    return true;
+  }
+  return false;
+}
+
+// check if the player is allowed to attack
+bool Player::isMyTurnToAttack() {
+  if (_turnCounterAttack >= GetAttackInterval()) {
+    _turnCounterAttack = 0;
+    return true;
+  }
+  return false;
+}
+
 // add new timed effect
 void Player::AddTimedEffect(int timer, std::string msg, int mod) {
     _timedEffects.emplace_back(std::make_unique<TimedEffect>());
@@ -201,8 +222,8 @@ void Player::UpdateEffects() {
         if (effect->counter > effect->timer) {
             // apply effect
             _visionMod = effect->mod;
-            std::cout << "---------------" << std::endl;
-            std::cout << effect->msg << std::endl;
+            Messages() << "---------------" << std::endl;
+            Messages() << effect->msg << std::endl;
             // mark as expired
             effect->expired = true;
         }
@@ -216,6 +237,15 @@ void Player::UpdateEffects() {
     
   }
 
+// used by the game loop to sleep until the next effect is due
+int Player::TicksUntilNextEffect() const {
+  int ticks = std::numeric_limits<int>::max();
+  for (std::unique_ptr<TimedEffect> const &effect : _timedEffects) {
+    ticks = std::min(ticks, effect->timer - effect->counter + 1);
+  }
+  return ticks;
+}
+
 // return current player vision e.g. for rendering
 Player::Vision Player::GetVision() { 
   
@@ -254,3 +284,14 @@ Player::Vision Player::GetVision() {
   // else not implemented, return default
   return Player::Vision::kDaylight;
 }
+
+int Player::GetVisionRadius() {
+  switch (GetVision()) {
+    case Player::Vision::kDaylight: return 8;
+    case Player::Vision::kCavern: return 7;
+    case Player::Vision::kDark1: return 6;
+    case Player::Vision::kDark2: return 5;
+    case Player::Vision::kDark3: return 4;
+  }
+  return 8;
+}
@@ -3,9 +3,10 @@
 
 #include <memory>
 #include <vector>
-#include "SDL.h"
+#include "point.h"
 #include "entity.h"
 #include "combattant.h"
+#include "message_log.h"
 
 // effects that can buff or nerf the player
 struct TimedEffect {
@@ -25,14 +26,21 @@ class Player : public Entity, public Combattant {
 
   enum class Vision { kDaylight, kCavern, kDark1, kDark2, kDark3 };
   // constructors and assignment operators   
-  Player() : Entity(_startX, _startY, Type::kPlayer) { InitStats(10, 6, 6, 8, 0, Faction::kNDEF, "Player"); }
+  Player(EntityStore &store, MessageLog &messages) : Entity(store, _startX, _startY, Type::kPlayer), _messages(messages) { 
+    InitStats(10, 6, 6, 8, 0, Faction::kNDEF, "Player"); 
+  }
 
   Player(const Player & source) = delete;           // delete copy constructor (unique pointers in inventory can't be copied)
   Player &operator=(const Player &source) = delete; // delete copy assignment operator (unique pointers in inventory can't be copied)
 
   // movement
-  SDL_Point tryMove();                              // try to move the player into the direction indicated by "direction"
+  Point tryMove();                              // try to move the player into the direction indicated by "direction"
   Direction direction = Direction::kNone;  
+
+  // the player's turns are paced by input: the turn counters only advance in ticks in which a move has been requested
+  bool isMyTurnToMove();
+  bool isMyTurnToAttack();
+  int TicksUntilMyTurnToMove() const { return GetMoveInterval() - _turnCounterMove; }   // number of isMyTurnToMove() calls until it returns true
   
   // game control methods
   bool hasKey() {return _hasKey; };                       // has the player found the key to the locked door?
@@ -43,6 +51,8 @@ class Player : public Entity, public Combattant {
   // map vision
   void SetVision(Vision vision) { _vision = vision; }
   Vision GetVision();
+  int GetVisionRadius();        // radius of the field of view, depending on GetVision()
+  int GetVisionMod() const { return _visionMod; }   // brightness of the player's torch: 0 (none), 1 (burns low) or 2
  
   // inventory methods
   void DisplayInventory(); 
@@ -52,6 +62,7 @@ class Player : public Entity, public Combattant {
   void SelectItem(int i);                                                     // select item from inventory and print message to console
   void SelectItem(int i, bool suppressText);                                  // select item from inventory and decide if message shall be printed to console
   void DeleteFromInventory(InventoryItem *item, int number);                  // delete "number" objects "item" from inventory
+  std::vector<std::unique_ptr<InventoryItem>> const &GetInventory() const { return _inventory; }   // item i is selected by SelectItem(i + 1)
 
   // combat - definition of virtual functions of class Combattant
   int GetAttackValue ();
@@ -60,10 +71,14 @@ class Player : public Entity, public Combattant {
   // active effects
   void AddTimedEffect(int timer, std::string msg, int mod);
   void UpdateEffects();
+  int TicksUntilNextEffect() const;   // number of UpdateEffects() calls until the next effect triggers (INT_MAX if none)
 
   // misc
   void ReceiveXP (int xp);          // add xp to player's total XP
-  int GetTotalXP () { return _XP; } 
+  int GetTotalXP () const { return _XP; } 
+
+  // game messages of the player and the objects the player interacts with (see MessageLog)
+  std::ostream &Messages() { return _messages.Stream(); }
 
  private: 
   // inventory
@@ -71,6 +86,10 @@ class Player : public Entity, public Combattant {
   InventoryItem* _equipped_weapon{nullptr};                 // the weapon the player uses
   InventoryItem* _equipped_armor{nullptr};                  // the armor the player wears
 
+  // turn counters
+  int _turnCounterMove{0};
+  int _turnCounterAttack{0};
+
   // active effects
   std::vector<std::unique_ptr<TimedEffect>> _timedEffects;
   
@@ -86,6 +105,8 @@ class Player : public Entity, public Combattant {
   // total player experience points
   int _XP{0}; 
 
+  MessageLog &_messages;
+
   // default start position  
   int _startX{0};
   int _startY{0};
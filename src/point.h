@@ -0,0 +1,11 @@
+#ifndef POINT_H
+#define POINT_H
+
+// position on the game map (in tiles). the game logic doesn't depend on SDL, so it uses its own point type. 
+// same layout as SDL_Point, the SDL front end converts where needed
+struct Point {
+  int x;
+  int y;
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// reference to an object in a Registry. unlike a raw pointer, a handle can be kept across frames:
+// once the object has been erased, the handle is detected as stale - even if its slot has been reused by another object
+struct EntityHandle {
+  static constexpr std::uint32_t kInvalid = 0xFFFFFFFF;
+  std::uint32_t index{kInvalid};
+  std::uint32_t generation{0};
+
+  bool isValid() const { return index != kInvalid; }
+};
+
+// container for the game objects of one kind (e.g. opponents), owning the objects and handing out generational handles
+// objects are stored densely in order of insertion, so iterating is a linear pass. a slot table maps handles to positions
+// erasure is deferred: objects are marked for erasure during the frame (see Entity::MarkForErasure) and removed in one batch by EraseMarked
+template <typename T> class Registry {
+ public:
+  using iterator = typename std::vector<std::unique_ptr<T>>::iterator;
+  using const_iterator = typename std::vector<std::unique_ptr<T>>::const_iterator;
+
+  void reserve(std::size_t n) {
+    _items.reserve(n);
+    _owners.reserve(n);
+    _slots.reserve(n);
+  }
+
+  // take ownership of an object and return its handle
+  EntityHandle Add(std::unique_ptr<T> item) {
+    std::uint32_t index;
+    if (!_freeSlots.empty()) {
+      index = _freeSlots.back();
+      _freeSlots.pop_back();
+    }
+    else {
+      index = static_cast<std::uint32_t>(_slots.size());
+      _slots.push_back({0, 0});
+    }
+    _slots[index].dense = static_cast<std::uint32_t>(_items.size());
+    _items.emplace_back(std::move(item));
+    _owners.push_back(index);
+    return {index, _slots[index].generation};
+  }
+
+  // returns the object a handle refers to, or nullptr if the handle is invalid or stale
+  T *Get(EntityHandle handle) const {
+    if (handle.index >= _slots.size() || _slots[handle.index].generation != handle.generation) { return nullptr; }
+    return _items[_slots[handle.index].dense].get();
+  }
+
+  // access by position (0 ... size()-1)
+  T *At(std::size_t i) const { return _items[i].get(); }
+  EntityHandle GetHandle(std::size_t i) const { return {_owners[i], _slots[_owners[i]].generation}; }
+
+  // remove all objects marked for erasure in a single pass (erase-remove). the remaining objects keep their order, 
+  // so update order - and thereby the outcome of the game - doesn't depend on which objects have been removed before
+  void EraseMarked() { EraseMarked([](T &) {}); }
+  // onErase is called for every removed object before it is destroyed (e.g. to drop data kept elsewhere for it)
+  template <typename F> void EraseMarked(F &&onErase) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < _items.size(); i++) {
+      if (_items[i]->isMarkedForErasure()) {
+        onErase(*_items[i]);
+        // invalidate all handles to the object and recycle its slot
+        _slots[_owners[i]].generation++;
+        _freeSlots.push_back(_owners[i]);
+        continue;
+      }
+      if (kept != i) {
+        _items[kept] = std::move(_items[i]);
+        _owners[kept] = _owners[i];
+        _slots[_owners[kept]].dense = static_cast<std::uint32_t>(kept);
+      }
+      kept++;
+    }
+    _items.resize(kept);
+    _owners.resize(kept);
+  }
+
+  std::size_t size() const { return _items.size(); }
+  bool empty() const { return _items.empty(); }
+  iterator begin() { return _items.begin(); }
+  iterator end() { return _items.end(); }
+  const_iterator begin() const { return _items.begin(); }
+  const_iterator end() const { return _items.end(); }
+
+ private:
+  struct Slot {
+    std::uint32_t dense;        // position of the object in _items
+    std::uint32_t generation;   // incremented when the object is erased
+  };
+
+  std::vector<std::unique_ptr<T>> _items{};   // objects, densely packed
+  std::vector<std::uint32_t> _owners{};       // slot of each object in _items
+  std::vector<Slot> _slots{};
+  std::vector<std::uint32_t> _freeSlots{};
+};
+
+#endif
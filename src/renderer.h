@@ -2,48 +2,23 @@
 #define RENDERER_H
 
 #include <vector>
-#include "SDL.h"
+#include "message_log.h"
 #include "player.h"
-#include "entity.h"
-#include "interactive_entity.h"
-#include "opponent.h"
-#include "door.h"
+#include "entity_store.h"
+#include "field_of_view.h"
+#include "light_map.h"
+#include "terrain_map.h"
 #include "tiletypes.h"
-#include "event.h"
-#include <memory>
 
+// render interface of the game loop. implemented by the SDL front end (SdlRenderer) and by NullRenderer for headless runs
 class Renderer {
  public:
-  Renderer(const std::size_t screen_width, const std::size_t screen_height,
-           const std::size_t grid_width, const std::size_t grid_height);
-  ~Renderer();
+  virtual ~Renderer() = default;
 
-  // no fog of war (bool = true if screen shall be cleared (default) - set to false if used on top of regular rendering)
-  void DebugRender(Player &player, std::vector<std::unique_ptr<InteractiveE>> &treasure, std::vector<std::unique_ptr<Entity>> &wall, std::vector<std::unique_ptr<Door>> &doors,
-              std::vector<std::unique_ptr<Opponent>> &opponents, std::vector<std::unique_ptr<InteractiveE>> &npcs, std::vector<std::unique_ptr<MapEvent>> &events, bool clearscreen);
-  
-  // WIP: with fog of war
-  void Render(Player &player, std::vector<std::unique_ptr<InteractiveE>> &treasure, std::vector<std::unique_ptr<Entity>> &wall, std::vector<std::unique_ptr<Door>> &doors,
-              std::vector<std::unique_ptr<Opponent>> &opponents, std::vector<std::unique_ptr<InteractiveE>> &npcs, std::vector<std::vector<MapTiles::VicinityTileType>> &vicinitymap, std::vector<std::vector<MapTiles::Type>> &rendermap);
-
-  
-
-  void UpdateWindowTitle(int fps);
-
- private:
-  // helper functions 
-  SDL_Point GetVector (SDL_Point from, SDL_Point to) { return {to.x - from.x, to.y - from.y}; }                 // straightforward position-delta calculation, taken from game-utils - include leads to linker error: REFACTOR!!  
-  bool isOnVicinityMap(SDL_Point vectorToPlayer, std::vector<std::vector<MapTiles::VicinityTileType>> &map);    // check if an entity replaced from player by vectorToPlayer shall be rendered
-  bool isOnRenderMap(SDL_Point vector, SDL_Point playerPos, std::vector<std::vector<MapTiles::Type>> &map);     // check if objectposition is within map boundaries
-
-  
-  SDL_Window *sdl_window;
-  SDL_Renderer *sdl_renderer;
-
-  const std::size_t screen_width;
-  const std::size_t screen_height;
-  const std::size_t grid_width;
-  const std::size_t grid_height;
+  // with fog of war: only the player's field of view is shown, shaded by the light levels. messages: game messages for display in the window
+  virtual void Render(Player &player, EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, TerrainMap const &terrain,
+                      MessageLog const &messages) = 0;
+  virtual void UpdateWindowTitle(int fps) = 0;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,53 @@
+#include "sdl_controller.h"
+#include "SDL.h"
+
+// block in SDL_WaitEventTimeout until an event arrives or timeout has passed
+void SdlController::WaitForInput(std::uint32_t timeout, std::vector<Command> &commands) {
+  SDL_Event e;
+  if (SDL_WaitEventTimeout(&e, static_cast<int>(timeout))) {
+    HandleEvent(e, commands);
+    HandleInput(commands);
+  }
+}
+
+void SdlController::HandleInput(std::vector<Command> &commands) const {
+  SDL_Event e;
+  while (SDL_PollEvent(&e)) {
+    HandleEvent(e, commands);
+  }
+}
+
+// translate events into commands. the commands are applied by the game (see Game::ApplyInput)
+void SdlController::HandleEvent(SDL_Event const &e, std::vector<Command> &commands) const {
+  if (e.type == SDL_QUIT) {
+    commands.push_back(Command::kQuit);
+  } else if (e.type == SDL_KEYDOWN) {
+    // detect key presses
+    switch (e.key.keysym.sym) {
+      // game control
+      case SDLK_p: commands.push_back(Command::kPause); break;
+      
+      // movement
+      case SDLK_UP: commands.push_back(Command::kUp); break;
+      case SDLK_DOWN: commands.push_back(Command::kDown); break;
+      case SDLK_LEFT: commands.push_back(Command::kLeft); break;
+      case SDLK_RIGHT: commands.push_back(Command::kRight); break;
+
+      // misc controls
+      // display player status
+      case SDLK_c: commands.push_back(Command::kStatus); break;
+      // display inventory
+      case SDLK_i: commands.push_back(Command::kInventory); break;
+      // equip or use inventory item
+      case SDLK_1: commands.push_back(Command::kSelectItem1); break;
+      case SDLK_2: commands.push_back(Command::kSelectItem2); break;
+      case SDLK_3: commands.push_back(Command::kSelectItem3); break;
+      case SDLK_4: commands.push_back(Command::kSelectItem4); break;
+      case SDLK_5: commands.push_back(Command::kSelectItem5); break;
+      case SDLK_6: commands.push_back(Command::kSelectItem6); break;
+      case SDLK_7: commands.push_back(Command::kSelectItem7); break;
+      case SDLK_8: commands.push_back(Command::kSelectItem8); break;
+      case SDLK_9: commands.push_back(Command::kSelectItem9); break;
+    }
+  }
+}
@@ -0,0 +1,22 @@
+#ifndef SDL_CONTROLLER_H
+#define SDL_CONTROLLER_H
+
+#include <vector>
+#include "SDL.h"
+#include "controller.h"
+
+// keyboard input & timing via SDL
+class SdlController : public Controller {
+ public:
+  std::uint32_t GetTicks() override { return SDL_GetTicks(); }
+  void WaitForInput(std::uint32_t timeout, std::vector<Command> &commands) override;
+
+  // handle all pending events
+  void HandleInput(std::vector<Command> &commands) const;
+  // handle a single event, e.g. one returned by SDL_WaitEventTimeout
+  void HandleEvent(SDL_Event const &e, std::vector<Command> &commands) const;
+
+ private:  
+};
+
+#endif
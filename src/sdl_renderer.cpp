@@ -0,0 +1,342 @@
+#include "sdl_renderer.h"
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+
+SdlRenderer::SdlRenderer(const std::size_t screen_width,
+                   const std::size_t screen_height,
+                   const std::size_t grid_width, const std::size_t grid_height, const std::size_t panel_height)
+    : screen_width(screen_width),
+      screen_height(screen_height),
+      grid_width(grid_width),
+      grid_height(grid_height) {
+  // Initialize SDL  
+  if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+    std::cerr << "SDL could not initialize.\n";
+    std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+  }
+
+  // Create Window
+  sdl_window = SDL_CreateWindow("DARWIN - Eat or be eaten   ||    Score: 0", SDL_WINDOWPOS_CENTERED,
+                                SDL_WINDOWPOS_CENTERED, screen_width,
+                                screen_height + panel_height, SDL_WINDOW_SHOWN);
+
+  if (nullptr == sdl_window) {
+    std::cerr << "Window could not be created.\n";
+    std::cerr << " SDL_Error: " << SDL_GetError() << "\n";
+  }
+
+  // Create renderer. with batching, consecutive copies from the same texture (e.g. the glyphs of the message panel) are sent to the GPU together
+  SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+  sdl_renderer = SDL_CreateRenderer(sdl_window, -1, SDL_RENDERER_ACCELERATED);
+  if (nullptr == sdl_renderer) {
+    std::cerr << "Renderer could not be created.\n";
+    std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
+  }
+
+  SDL_Rect panel{0, static_cast<int>(screen_height), static_cast<int>(screen_width), static_cast<int>(panel_height)};
+  _messagePanel = std::make_unique<MessagePanel>(sdl_renderer, panel, 2);
+}
+
+SdlRenderer::~SdlRenderer() {
+  _messagePanel.reset();
+  if (_terrainTexture != nullptr) { SDL_DestroyTexture(_terrainTexture); }
+  if (_visionMask != nullptr) { SDL_DestroyTexture(_visionMask); }
+  SDL_DestroyWindow(sdl_window);
+  SDL_Quit();
+}
+
+// ------------------------------------------------
+// DEBUG RENDER : MAP WIREFRAME WITHOUT FOG OF WAR
+// ------------------------------------------------
+void SdlRenderer::DebugRender(Player &player, Registry<InteractiveE> &treasure, TerrainMap const &terrain, Registry<Door> &doors,
+                      Registry<Opponent> &opponents, Registry<InteractiveE> &npcs, Registry<MapEvent> &events, bool clearscreen) {
+  SDL_Rect block;
+  block.w = screen_width / grid_width;
+  block.h = screen_height / grid_height;
+
+  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
+
+  // Clear screen
+  if (clearscreen) {
+    SDL_SetRenderDrawColor(sdl_renderer, 0x1E, 0x1E, 0x1E, 0xFF);
+    SDL_RenderClear(sdl_renderer);
+  }
+
+  // collect all objects in the draw list, grouped by color
+  // Render treasure
+  for (std::unique_ptr<InteractiveE> &item : treasure) {
+    block.x = item->GetPosition().x * block.w;
+    block.y = item->GetPosition().y * block.h;
+    if (item->GetType() == Entity::Type::kChest ) { _drawlist.Add(block, 0xFFAB6043); }
+    else if (item->GetType() == Entity::Type::kLoot ) { _drawlist.Add(block, 0xFF00F0EE); }
+    else { _drawlist.Add(block, 0xFFFFCC00); }
+  }
+
+  // Render NPCs
+  for (std::unique_ptr<InteractiveE> &item : npcs) {
+    block.x = item->GetPosition().x * block.w;
+    block.y = item->GetPosition().y * block.h;
+    _drawlist.Add(block, 0xFF00F0EE);
+  }
+
+  // Render wall
+  for (int y = 0; y < terrain.GetHeight(); y++) {
+    for (int x = 0; x < terrain.GetWidth(); x++) {
+      if (terrain.GetType({x, y}) != MapTiles::Type::kOuterWall) { continue; }
+      block.x = x * block.w;
+      block.y = y * block.h;
+      _drawlist.Add(block, 0xFFFFFFFF);
+    }
+  }
+
+  // Render doors
+  for (std::unique_ptr<Door> &door : doors) {      
+    Uint32 color = 0xFF9B5023;
+    if (door->GetDoorType() == Door::DoorType::kDiscovered) { color = 0xFF999999; }
+    if (door->GetDoorType() == Door::DoorType::kSecret) { color = 0xFFFFFFFF; }
+    block.x = door->GetAnchorPosition().x * block.w;
+    block.y = door->GetAnchorPosition().y  * block.h;
+    _drawlist.Add(block, color);
+    block.x = door->GetWingPosition().x * block.w;
+    block.y = door->GetWingPosition().y  * block.h;
+    _drawlist.Add(block, color);
+  }
+
+  // Render opponents
+  for (std::unique_ptr<Opponent> &opponent : opponents) {
+    block.x = opponent->GetPosition().x * block.w;
+    block.y = opponent->GetPosition().y * block.h;
+    _drawlist.Add(block, 0xFFFF0000);
+  }
+
+  // Render events
+  for (std::unique_ptr<MapEvent> &event : events) {
+    for (Point point : event->GetArea()) {        
+      block.x = point.x * block.w;
+      block.y = point.y * block.h;
+      _drawlist.Add(block, 0x55FFAEC9);
+    }
+  }
+
+  // Render player
+  block.x = player.GetPosition().x * block.w;
+  block.y = player.GetPosition().y * block.h;
+  _drawlist.Add(block, player.alive ? 0xFF007ACC : 0xFFFF0000);
+  _drawlist.Submit(sdl_renderer);
+
+  // Update Screen
+  SDL_RenderPresent(sdl_renderer);
+}
+
+
+void SdlRenderer::UpdateWindowTitle(int fps) {
+  // use this line for debug output (fps)
+  // std::string title{"Dungeons of Ellesmere - Quest for the Golden McGuffin || FPS: " + std::to_string(fps)}; 
+  // use this line for output of player score only
+  std::string title{"Dungeons of Ellesmere - Quest for the Golden McGuffin"};
+  SDL_SetWindowTitle(sdl_window, title.c_str());
+}
+
+
+
+// ---------------------------------------------------------------------
+// RENDER COLORED GAME MAP WITH FOG OF WAR, SHADED BY THE TILES' LIGHT
+// ---------------------------------------------------------------------
+
+void SdlRenderer::Render(Player &player, EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, TerrainMap const &terrain,
+                         MessageLog const &messages) {
+  
+  // define brush for painting squares
+  SDL_Rect block;
+  block.w = screen_width / grid_width;
+  block.h = screen_height / grid_height;
+  
+  // activate alpha blending
+  SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
+  
+  // Clear screen
+  SDL_SetRenderDrawColor(sdl_renderer, 0x1E, 0x1E, 0x1E, 0xFF);
+  SDL_RenderClear(sdl_renderer);
+
+
+  // render map terrain & doors in player's field of view: copy the region around the player from the static layer, then cover the hidden tiles 
+  // and shade the visible ones with the vision mask
+  // the texture holds one pixel per tile and is scaled to the block size. parts of the region outside the map are clipped by SDL
+  if (_terrainTexture == nullptr || _bakedRevision != terrain.GetRevision()) { BakeTerrain(terrain, entities); }
+  VisionPasses const &passes = GetVisionPasses(fov.GetRadius());
+  if (_visionMask == nullptr || _maskRevision != fov.GetRevision() || _maskLights != lights.GetRevision()) { (this->*passes.bakeVisionMask)(fov, lights); }
+  UpdateDoors(entities, terrain);
+
+  int range = FieldOfView::kSize;
+  SDL_Rect region{fov.GetOrigin().x - FieldOfView::kMaxRadius, fov.GetOrigin().y - FieldOfView::kMaxRadius, range, range};
+  SDL_Rect screenRegion{region.x * block.w, region.y * block.h, range * block.w, range * block.h};
+  SDL_RenderCopy(sdl_renderer, _terrainTexture, &region, &screenRegion);
+  SDL_RenderCopy(sdl_renderer, _visionMask, nullptr, &screenRegion);
+
+  // Render treasure, NPCs & opponents in the field of view
+  (this->*passes.addEntities)(entities, fov, lights, block);
+
+  // Render player, shaded like the entities
+  block.x = player.GetPosition().x * block.w;
+  block.y = player.GetPosition().y * block.h;
+  _drawlist.Add(block, WithAlpha(player.alive ? 0xFF0048DD : 0xFF800000, lights.GetLevel(player.GetPosition())));
+  _drawlist.Submit(sdl_renderer);
+
+  // message panel below the map
+  _messagePanel->Render(sdl_renderer, messages);
+  
+  // Update Screen
+  SDL_RenderPresent(sdl_renderer);
+}
+
+
+
+
+// -----------------
+// HELPER FUNCTIONS
+// -----------------
+
+
+// colors of map objects (0xAARRGGBB, fully opaque). returns 0 if the type isn't drawn as map object
+Uint32 SdlRenderer::GetEntityColor(Entity::Type type) {
+  switch (type) {
+    case Entity::Type::kChest: return 0xFFAB6043;
+    case Entity::Type::kLoot:
+    case Entity::Type::kNPC: return 0xFF00F0EE;
+    case Entity::Type::kTreasure: return 0xFFFFCC00;
+    case Entity::Type::kOpponent: return 0xFFFF0000;
+    default: return 0;   // doors are part of the static layer, events & player are not drawn as map objects
+  }
+}
+
+// colors of the static layer (0xAARRGGBB)
+Uint32 SdlRenderer::GetTerrainColor(MapTiles::Type type) {
+  switch (type) {
+    case MapTiles::Type::kFloor: return 0xFF442200;
+    case MapTiles::Type::kOuterWall: return 0xFF999999;
+    case MapTiles::Type::kInnerWall: return 0xFF555555;
+    case MapTiles::Type::kBedrock: return 0xFF222222;
+    case MapTiles::Type::kGras: return 0xFF007F00;
+    default: return 0xFFAB6043;
+  }
+}
+
+Uint32 SdlRenderer::GetDoorColor(std::uint8_t variant) {
+  if (static_cast<Door::DoorType>(variant) == Door::DoorType::kDiscovered) { return 0xFF777777; }
+  if (static_cast<Door::DoorType>(variant) == Door::DoorType::kSecret) { return 0xFF999999; }
+  return 0xFFAB6043;
+}
+
+// bake the terrain of the whole map into the static layer and collect the slots of the level's doors. done once per level
+void SdlRenderer::BakeTerrain(TerrainMap const &terrain, EntityStore const &entities) {
+  if (_terrainTexture != nullptr) { SDL_DestroyTexture(_terrainTexture); }
+  _terrainTexture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, terrain.GetWidth(), terrain.GetHeight());
+  std::vector<Uint32> pixels(static_cast<std::size_t>(terrain.GetWidth()) * terrain.GetHeight());
+  for (int y = 0; y < terrain.GetHeight(); y++) {
+    for (int x = 0; x < terrain.GetWidth(); x++) {
+      pixels[y * terrain.GetWidth() + x] = GetTerrainColor(terrain.GetType({x, y}));
+    }
+  }
+  SDL_UpdateTexture(_terrainTexture, nullptr, pixels.data(), terrain.GetWidth() * sizeof(Uint32));
+  _bakedRevision = terrain.GetRevision();
+  _bakedDoors.clear();
+
+  _doorSlots.clear();
+  for (int slot = 0; slot < entities.GetSize(); slot++) {
+    if (entities.isLive(slot) && static_cast<Entity::Type>(entities.GetType(slot)) == Entity::Type::kDoor) { _doorSlots.push_back(slot); }
+  }
+}
+
+// compare the doors of the level with the baked ones. only if a door has been opened or discovered, its old and new tiles are re-baked
+// doors are only created with the level, so only their slots are looked at (a slot which doesn't hold a door anymore is skipped)
+void SdlRenderer::UpdateDoors(EntityStore const &entities, TerrainMap const &terrain) {
+  _currentDoors.clear();
+  for (int slot : _doorSlots) {
+    if (entities.isLive(slot) && static_cast<Entity::Type>(entities.GetType(slot)) == Entity::Type::kDoor) {
+      _currentDoors.push_back({entities.GetPosition(slot), entities.GetVariant(slot)});
+    }
+  }
+
+  auto isSame = [](BakedDoor const &a, BakedDoor const &b) { return a.position.x == b.position.x && a.position.y == b.position.y && a.variant == b.variant; };
+  if (_currentDoors.size() == _bakedDoors.size() && std::equal(_currentDoors.begin(), _currentDoors.end(), _bakedDoors.begin(), isSame)) { return; }
+
+  for (BakedDoor const &door : _bakedDoors) { BakeTile(door.position, GetTerrainColor(terrain.GetType(door.position))); }
+  for (BakedDoor const &door : _currentDoors) { BakeTile(door.position, GetDoorColor(door.variant)); }
+  std::swap(_bakedDoors, _currentDoors);
+}
+
+void SdlRenderer::BakeTile(Point point, Uint32 color) {
+  SDL_Rect tile{point.x, point.y, 1, 1};
+  SDL_UpdateTexture(_terrainTexture, &tile, &color, sizeof(Uint32));
+}
+
+// re-baked whenever the field of view has been recomputed or the light has changed: hidden tiles are covered with the background color,
+// visible tiles are darkened by the inverse of their light level (i.e. transparent in daylight), the fringe is faded out on top
+template <int Radius>
+void SdlRenderer::BakeVisionMask(FieldOfView const &fov, LightMap const &lights) {
+  int range = FieldOfView::kSize;
+  if (_visionMask == nullptr) {
+    _visionMask = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, range, range);
+    SDL_SetTextureBlendMode(_visionMask, SDL_BLENDMODE_BLEND);
+  }
+  Point corner{fov.GetOrigin().x - FieldOfView::kMaxRadius, fov.GetOrigin().y - FieldOfView::kMaxRadius};
+  std::vector<Uint32> pixels(range * range);
+  for (int y = 0; y < range; y++) {
+    std::uint32_t visible = fov.GetRow(y);
+    std::uint32_t inside = visible & VisionMask<Radius>::kInside[y];
+    for (int x = 0; x < range; x++) {
+      Uint32 pixel = 0xFF1E1E1E;   // background color
+      Uint32 light = lights.GetLevel({corner.x + x, corner.y + y});
+      if ((inside >> x) & 1u) { pixel = (0xFF - light) << 24; }
+      else if ((visible >> x) & 1u) { pixel = ((0xFF - light * 0x55 / 0xFF) << 24) | 0x1E1E1E; }
+      pixels[y * range + x] = pixel;
+    }
+  }
+  SDL_UpdateTexture(_visionMask, nullptr, pixels.data(), range * sizeof(Uint32));
+  _maskRevision = fov.GetRevision();
+  _maskLights = lights.GetRevision();
+}
+
+// linear pass over the entity store, collected in the draw list. entities are blended into the shaded terrain by the light level of their
+// tile, entities on the fringe of the field of view are faded out further. opponents are added in a second pass, so they stay on top of
+// treasure they are walking over
+template <int Radius>
+void SdlRenderer::AddEntities(EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, SDL_Rect block) {
+  Point corner{fov.GetOrigin().x - FieldOfView::kMaxRadius, fov.GetOrigin().y - FieldOfView::kMaxRadius};
+  for (int pass = 0; pass < 2; pass++) {
+    for (int slot = 0; slot < entities.GetSize(); slot++) {
+      if (!entities.isLive(slot)) { continue; }
+      Entity::Type type = static_cast<Entity::Type>(entities.GetType(slot));
+      if ((type == Entity::Type::kOpponent) != (pass == 1)) { continue; }
+
+      // position in the window of the field of view
+      Point position = entities.GetPosition(slot);
+      int x = position.x - corner.x;
+      int y = position.y - corner.y;
+      if (x < 0 || y < 0 || x >= FieldOfView::kSize || y >= FieldOfView::kSize) { continue; }
+      std::uint32_t visible = fov.GetRow(y);
+      if (((visible >> x) & 1u) == 0) { continue; }
+      int alpha = ((visible & VisionMask<Radius>::kInside[y]) >> x) & 1u ? 0xFF : 0x55;
+      alpha = alpha * lights.GetLevel(position) / 0xFF;
+
+      Uint32 color = GetEntityColor(type);
+      if (color == 0) { continue; }
+      block.x = position.x * block.w;
+      block.y = position.y * block.h;
+      _drawlist.Add(block, WithAlpha(color, alpha));
+    }
+  }
+}
+
+template <int... Radius>
+constexpr std::array<SdlRenderer::VisionPasses, sizeof...(Radius)> SdlRenderer::MakeVisionPasses(std::integer_sequence<int, Radius...>) {
+  return {{{&SdlRenderer::BakeVisionMask<Radius>, &SdlRenderer::AddEntities<Radius>}...}};
+}
+
+// the instantiations of the passes for the radius of the field of view
+SdlRenderer::VisionPasses const &SdlRenderer::GetVisionPasses(int radius) {
+  static constexpr std::array<VisionPasses, FieldOfView::kMaxRadius + 1> kPasses = MakeVisionPasses(std::make_integer_sequence<int, FieldOfView::kMaxRadius + 1>());
+  return kPasses[radius];
+}
@@ -0,0 +1,99 @@
+#ifndef SDL_RENDERER_H
+#define SDL_RENDERER_H
+
+#include <array>
+#include <utility>
+#include <vector>
+#include "SDL.h"
+#include "player.h"
+#include "entity.h"
+#include "entity_store.h"
+#include "interactive_entity.h"
+#include "opponent.h"
+#include "door.h"
+#include "tiletypes.h"
+#include "terrain_map.h"
+#include "draw_list.h"
+#include "message_panel.h"
+#include "event.h"
+#include "field_of_view.h"
+#include "light_map.h"
+#include "registry.h"
+#include "renderer.h"
+#include <memory>
+
+// renders the game with SDL2
+class SdlRenderer : public Renderer {
+ public:
+  // the map covers screen_width x screen_height, the message panel is shown below the map
+  SdlRenderer(const std::size_t screen_width, const std::size_t screen_height,
+           const std::size_t grid_width, const std::size_t grid_height, const std::size_t panel_height);
+  ~SdlRenderer();
+
+  // no fog of war (bool = true if screen shall be cleared (default) - set to false if used on top of regular rendering)
+  void DebugRender(Player &player, Registry<InteractiveE> &treasure, TerrainMap const &terrain, Registry<Door> &doors,
+              Registry<Opponent> &opponents, Registry<InteractiveE> &npcs, Registry<MapEvent> &events, bool clearscreen);
+  
+  // WIP: with fog of war
+  // entities are drawn in a linear pass over the entity store
+  void Render(Player &player, EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, TerrainMap const &terrain,
+              MessageLog const &messages) override;
+
+  
+
+  void UpdateWindowTitle(int fps) override;
+
+ private:
+  // helper functions 
+  static Uint32 GetEntityColor(Entity::Type type);                                                                // draw color by entity type
+  static Uint32 WithAlpha(Uint32 color, int alpha) { return (color & 0x00FFFFFF) | (static_cast<Uint32>(alpha) << 24); }
+
+  // static layer: terrain & doors, baked into a texture with one pixel per tile. drawn with a single copy of the region around the player
+  void BakeTerrain(TerrainMap const &terrain, EntityStore const &entities);
+  void UpdateDoors(EntityStore const &entities, TerrainMap const &terrain);   // re-bake the tiles of doors that have moved or changed their type
+  void BakeTile(Point point, Uint32 color);
+  static Uint32 GetTerrainColor(MapTiles::Type type);
+  static Uint32 GetDoorColor(std::uint8_t variant);
+
+  // passes which depend on the vision radius: instantiated for every radius, so their vision masks (see VisionMask) are constants
+  template <int Radius> void BakeVisionMask(FieldOfView const &fov, LightMap const &lights);
+  template <int Radius> void AddEntities(EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, SDL_Rect block);
+  struct VisionPasses {
+    void (SdlRenderer::*bakeVisionMask)(FieldOfView const &fov, LightMap const &lights);
+    void (SdlRenderer::*addEntities)(EntityStore const &entities, FieldOfView const &fov, LightMap const &lights, SDL_Rect block);
+  };
+  template <int... Radius> static constexpr std::array<VisionPasses, sizeof...(Radius)> MakeVisionPasses(std::integer_sequence<int, Radius...>);
+  static VisionPasses const &GetVisionPasses(int radius);
+
+  
+  SDL_Window *sdl_window;
+  SDL_Renderer *sdl_renderer;
+
+  // rectangles of the current frame, grouped by color
+  DrawList _drawlist{};
+
+  // static layer cache
+  struct BakedDoor {
+    Point position;
+    std::uint8_t variant;
+  };
+  SDL_Texture *_terrainTexture{nullptr};
+  unsigned int _bakedRevision{0};         // revision of the terrain the texture was baked from, to detect a level change
+  std::vector<int> _doorSlots{};          // entity store slots of the level's doors
+  std::vector<BakedDoor> _bakedDoors{};
+  std::vector<BakedDoor> _currentDoors{};
+  // vision mask: covers the hidden tiles with the background color and shades the visible ones by their light level, drawn on top of the terrain
+  SDL_Texture *_visionMask{nullptr};
+  unsigned int _maskRevision{0};    // revision of the field of view the mask was baked from
+  unsigned int _maskLights{0};      // revision of the light map the mask was baked from
+
+  // game messages, drawn from a bitmap font atlas
+  std::unique_ptr<MessagePanel> _messagePanel{};
+
+  const std::size_t screen_width;
+  const std::size_t screen_height;
+  const std::size_t grid_width;
+  const std::size_t grid_height;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "game.h"
+#include "headless_controller.h"
+#include "input_log.h"
+#include "message_log.h"
+#include "null_renderer.h"
+#include "pcg32.h"
+
+// headless batch runner for balancing: plays many full games with a scripted player policy, spread across all cores, and reports
+// win rate, time to win, time to find the McGuffin, deaths and the XP distribution. a game is played until it has been won, the player
+// has died or the game has been aborted; the tick limit is only a safety net for games in which the policy gets stuck
+// usage: simulate [--games <n>] [--threads <n>] [--ticks <max ticks per game>] [--policy explore|random|persistent] [--seed <n>]
+//        simulate --replay <file>: plays a recorded session (see Ellesmere --record) back at maximum speed, e.g. for performance regression runs
+// every worker plays its games on its own Game instance, which rolls all dice with its own random streams, and the player policy has a
+// stream of its own: the workers share no state except the game counter. game i is seeded with seed + i, so every game of a batch can
+// be reproduced. run from the build directory (the level is read from levelmap.lvl)
+
+namespace {
+
+constexpr int kTicksPerSecond{60};
+constexpr std::uint64_t kPolicyStream{~0ull >> 1};   // random stream of the player policy, apart from the game's streams
+
+// player policies:
+// explore: walk to the closest unexplored tile, chest, door or treasure and return the McGuffin once it has been found (see Explorer)
+// random: a new random direction for every move
+// persistent: keep walking in the same direction until blocked, then pick a new random direction
+enum class Policy { kExplore, kRandom, kPersistent };
+
+struct Options {
+  int games{1000};
+  int threads{static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))};
+  std::uint64_t ticks{216000};   // 1 hour of game time
+  Policy policy{Policy::kExplore};
+  std::uint64_t seed{1};
+  std::string replay{};
+};
+
+struct Result {
+  bool won{false};
+  bool died{false};
+  bool aborted{false};             // the game has thrown, e.g. the quest giver's patience has run out (see InteractiveE::Talk)
+  std::uint64_t ticks{0};
+  std::uint64_t mcguffinTick{0};   // 0: not found
+  int xp{0};
+};
+
+// a player who knows the map but not what has happened on it. every move is the first step of the shortest path to the closest target:
+// - without the McGuffin: a tile not stood on yet, treasure, a chest not opened yet or a closed door. a door takes up to three bumps 
+//   (discover, unlock, open), a locked one is tried again once the key has been found. the quest giver is avoided, since annoying him
+//   ends the game
+// - with the McGuffin: the quest giver
+// opponents on the way are fought, as walking into them attacks. the best weapon & armor found are equipped, and a healing potion is
+// used once the player is badly hurt
+class Explorer {
+ public:
+  explicit Explorer(OccupancyGrid const &grid) : _grid(grid), _width(grid.GetWidth()) {
+    std::size_t tiles = static_cast<std::size_t>(grid.GetWidth()) * grid.GetHeight();
+    _visited.assign(tiles, false);
+    _opened.assign(tiles, false);
+    _doorBumps.assign(tiles, 0);
+    _first.assign(tiles, Entity::Direction::kNone);
+    _seen.assign(tiles, 0);
+  }
+
+  // kNone if no target is reachable
+  Entity::Direction NextMove(Player &player) {
+    UseItems(player);
+    if (player.hasKey() && !_hadKey) {
+      std::fill(_doorBumps.begin(), _doorBumps.end(), 0);
+      _hadKey = true;
+    }
+    Point start = player.GetPosition();
+    _visited[Cell(start)] = true;
+
+    // breadth-first search from the player's position. _seen holds the number of the search which has reached a tile
+    _search++;
+    _queue.clear();
+    _queue.push_back(start);
+    _seen[Cell(start)] = _search;
+    for (std::size_t head = 0; head < _queue.size(); head++) {
+      Point point = _queue[head];
+      for (int i = 0; i < 4; i++) {
+        Entity::Direction direction = static_cast<Entity::Direction>(i);
+        Point next = Neighbor(point, direction);
+        if (_grid.IsBlocked(next, OccupancyGrid::kWall) || _seen[Cell(next)] == _search) { continue; }
+        _seen[Cell(next)] = _search;
+        _first[Cell(next)] = head == 0 ? direction : _first[Cell(point)];
+        if (isTarget(next, player)) { return Approach(next, Neighbor(start, _first[Cell(next)])); }
+        // doors, NPCs & chests can only be bumped into
+        if (!_grid.IsBlocked(next, OccupancyGrid::kDoor | OccupancyGrid::kNPC | OccupancyGrid::kChest)) { _queue.push_back(next); }
+      }
+    }
+    return Entity::Direction::kNone;
+  }
+
+ private:
+  int Cell(Point point) const { return point.y * _width + point.x; }
+
+  static Point Neighbor(Point point, Entity::Direction direction) {
+    switch (direction) {
+      case Entity::Direction::kUp: return {point.x, point.y - 1};
+      case Entity::Direction::kDown: return {point.x, point.y + 1};
+      case Entity::Direction::kLeft: return {point.x - 1, point.y};
+      case Entity::Direction::kRight: return {point.x + 1, point.y};
+      default: return point;
+    }
+  }
+
+  void UseItems(Player &player) {
+    auto const &inventory = player.GetInventory();
+    if (inventory.size() != _items) {
+      _items = inventory.size();
+      int weapon = -1, armor = -1;
+      for (int i = 0; i < static_cast<int>(inventory.size()); i++) {
+        auto better = [&](int best) { return best < 0 || inventory[i]->attack_mod + inventory[i]->defense_mod > inventory[best]->attack_mod + inventory[best]->defense_mod; };
+        if (inventory[i]->isWeapon && better(weapon)) { weapon = i; }
+        if (inventory[i]->isArmor && better(armor)) { armor = i; }
+      }
+      if (weapon >= 0) { player.SelectItem(weapon + 1, true); }
+      if (armor >= 0) { player.SelectItem(armor + 1, true); }
+    }
+    if (player.GetHP() * 3 > player.GetMaxHP()) { return; }
+    for (int i = 0; i < static_cast<int>(inventory.size()); i++) {
+      if (inventory[i]->healing > 0) {
+        player.SelectItem(i + 1, true);
+        _items = inventory.size();    // a used up potion is removed from the inventory
+        return;
+      }
+    }
+  }
+
+  bool isTarget(Point point, Player &player) const {
+    if (player.hasMcGuffin()) { return _grid.IsBlocked(point, OccupancyGrid::kNPC); }
+    if (_grid.IsBlocked(point, OccupancyGrid::kNPC)) { return false; }
+    if (_grid.IsBlocked(point, OccupancyGrid::kChest)) { return !_opened[Cell(point)]; }
+    if (_grid.IsBlocked(point, OccupancyGrid::kDoor)) { return _doorBumps[Cell(point)] < 3; }
+    return !_visited[Cell(point)] || _grid.IsBlocked(point, OccupancyGrid::kTreasure);
+  }
+
+  // the first step towards the target. a bump into the target is remembered, so the target is dropped once it has been dealt with
+  Entity::Direction Approach(Point target, Point step) {
+    if (step.x == target.x && step.y == target.y) {
+      if (_grid.IsBlocked(target, OccupancyGrid::kChest)) { _opened[Cell(target)] = true; }
+      if (_grid.IsBlocked(target, OccupancyGrid::kDoor)) { _doorBumps[Cell(target)]++; }
+    }
+    return _first[Cell(target)];
+  }
+
+  OccupancyGrid const &_grid;
+  int _width;
+  bool _hadKey{false};
+  std::size_t _items{0};                        // inventory size at the last check for new weapons & armor
+  std::vector<bool> _visited;                   // per tile: the player has stood on it
+  std::vector<bool> _opened;                    // per tile: the chest on it has been bumped into
+  std::vector<std::uint8_t> _doorBumps;         // per tile: bumps into the door on it
+  std::vector<Entity::Direction> _first;        // per tile: first step of the shortest path found by the current search
+  std::vector<unsigned int> _seen;
+  unsigned int _search{0};
+  std::vector<Point> _queue;
+};
+
+Result PlayGame(Options const &options, std::uint64_t seed) {
+  MessageLog messages;    // not started: the game's messages are only kept in the history
+  Game game(seed, messages);
+  Player &player = game.GetPlayer();
+  Pcg32 rng(seed, kPolicyStream);
+  Explorer explorer(game.GetObstacles());
+
+  Result result;
+  Entity::Direction heading = static_cast<Entity::Direction>(rng.Roll(4));
+  Point last = player.GetPosition();
+  try {
+    while (!game.isOver() && game.GetTick() < options.ticks) {
+      // a new move is requested once the previous one has been made (the player resets its direction after moving)
+      if (player.direction == Entity::Direction::kNone) {
+        Point position = player.GetPosition();
+        bool blocked = position.x == last.x && position.y == last.y;
+        if (options.policy == Policy::kExplore) { heading = explorer.NextMove(player); }
+        // random moves if the explorer has no target left
+        if (options.policy == Policy::kRandom || heading == Entity::Direction::kNone || (options.policy == Policy::kPersistent && blocked)) {
+          heading = static_cast<Entity::Direction>(rng.Roll(4));
+        }
+        last = position;
+        player.direction = heading;
+      }
+      game.Step();
+      if (result.mcguffinTick == 0 && player.hasMcGuffin()) { result.mcguffinTick = game.GetTick(); }
+    }
+  } catch (std::exception const &) {
+    result.aborted = true;
+  }
+  result.won = game.isWon();
+  result.died = !player.alive;
+  result.ticks = game.GetTick();
+  result.xp = player.GetTotalXP();
+  return result;
+}
+
+bool ParseOptions(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (i + 1 >= argc) { return false; }
+    std::string value = argv[++i];
+    if (arg == "--games") { options.games = std::atoi(value.c_str()); }
+    else if (arg == "--threads") { options.threads = std::atoi(value.c_str()); }
+    else if (arg == "--ticks") { options.ticks = std::strtoull(value.c_str(), nullptr, 10); }
+    else if (arg == "--seed") { options.seed = std::strtoull(value.c_str(), nullptr, 10); }
+    else if (arg == "--replay") { options.replay = value; }
+    else if (arg == "--policy" && value == "explore") { options.policy = Policy::kExplore; }
+    else if (arg == "--policy" && value == "random") { options.policy = Policy::kRandom; }
+    else if (arg == "--policy" && value == "persistent") { options.policy = Policy::kPersistent; }
+    else { return false; }
+  }
+  return options.games > 0 && options.threads > 0 && options.ticks > 0;
+}
+
+// value at fraction q of the sorted values
+template <typename T> T Percentile(std::vector<T> const &sorted, double q) {
+  return sorted[static_cast<std::size_t>(q * (sorted.size() - 1) + 0.5)];
+}
+
+void Report(Options const &options, std::vector<Result> const &results, double seconds) {
+  int deaths = 0, aborts = 0, timeouts = 0;
+  std::vector<std::uint64_t> won;
+  std::vector<std::uint64_t> mcguffin;
+  std::vector<int> xp;
+  std::uint64_t ticks = 0;
+  for (Result const &result : results) {
+    if (result.won) { won.push_back(result.ticks); }
+    else if (result.died) { deaths++; }
+    else if (result.aborted) { aborts++; }
+    else { timeouts++; }
+    if (result.mcguffinTick != 0) { mcguffin.push_back(result.mcguffinTick); }
+    xp.push_back(result.xp);
+    ticks += result.ticks;
+  }
+  std::sort(won.begin(), won.end());
+  std::sort(mcguffin.begin(), mcguffin.end());
+  std::sort(xp.begin(), xp.end());
+  // min, median, p90 & max of ticks, in seconds of game time
+  auto times = [](std::vector<std::uint64_t> const &sorted) {
+    std::cout << "min " << sorted.front() / double(kTicksPerSecond) << ", median " << Percentile(sorted, 0.5) / double(kTicksPerSecond)
+              << ", p90 " << Percentile(sorted, 0.9) / double(kTicksPerSecond) << ", max " << sorted.back() / double(kTicksPerSecond);
+  };
+
+  double const games = static_cast<double>(results.size());
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << results.size() << " games on " << options.threads << " threads in " << seconds << " s (" << games / seconds << " games/s, " 
+            << ticks / seconds << " ticks/s)" << std::endl;
+  std::cout << "won:      " << won.size() << " (" << 100.0 * won.size() / games << "%)";
+  if (!won.empty()) {
+    std::cout << ", time to win (s): ";
+    times(won);
+  }
+  std::cout << std::endl;
+  std::cout << "died:     " << deaths << " (" << 100.0 * deaths / games << "%)" << std::endl;
+  std::cout << "aborted:  " << aborts << " (" << 100.0 * aborts / games << "%)" << std::endl;
+  std::cout << "timeout:  " << timeouts << " (" << 100.0 * timeouts / games << "%)" << std::endl;
+  std::cout << "McGuffin: found in " << mcguffin.size() << " games";
+  if (!mcguffin.empty()) {
+    std::cout << ", time to find (s): ";
+    times(mcguffin);
+  }
+  std::cout << std::endl;
+  std::cout << "XP:       min " << xp.front() << ", p10 " << Percentile(xp, 0.1) << ", median " << Percentile(xp, 0.5) << ", p90 " << Percentile(xp, 0.9)
+            << ", max " << xp.back() << std::endl;
+}
+
+// replay a recorded session through the game loop, headless & as fast as possible
+int Replay(std::string const &path) {
+  InputLog log;
+  if (!log.Load(path)) { return 1; }
+
+  auto start = std::chrono::steady_clock::now();
+  MessageLog messages;
+  Game game(log.GetSeed(), messages);
+  NullRenderer renderer;
+  HeadlessController controller(UINT32_MAX);
+  game.StartReplay(log);
+  game.Run(controller, renderer, 1000 / kTicksPerSecond);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "replayed " << log.GetEntries().size() << " commands, " << game.GetTick() << " ticks in " << seconds << " s (" 
+            << game.GetTick() / seconds << " ticks/s, " << renderer.GetFrameCount() << " frames)" << std::endl;
+  std::cout << (game.hasReplayDiverged() ? "DIVERGED from the recorded session" : "identical to the recorded session") << std::endl;
+  return game.hasReplayDiverged() ? 2 : 0;
+}
+
+} // end namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  if (!ParseOptions(argc, argv, options)) {
+    std::cerr << "usage: " << argv[0] << " [--games <n>] [--threads <n>] [--ticks <max ticks per game>] [--policy explore|random|persistent] [--seed <n>] | --replay <file>" << std::endl;
+    return 1;
+  }
+  if (!options.replay.empty()) { return Replay(options.replay); }
+
+  // workers take the next game from a shared counter. results are stored by index
+  std::vector<Result> results(options.games);
+  std::atomic<int> next{0};
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < options.threads; t++) {
+    workers.emplace_back([&]() {
+      for (int i = next++; i < options.games; i = next++) { results[i] = PlayGame(options, options.seed + i); }
+    });
+  }
+  for (std::thread &worker : workers) { worker.join(); }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  Report(options, results, seconds);
+  return 0;
+}
@@ -0,0 +1,37 @@
+#include "simulation_clock.h"
+
+#include <algorithm>
+
+// restart accumulating from now
+void SimulationClock::Reset(std::uint32_t now) {
+  _last = now;
+  _accumulator = 0;
+}
+
+// collect the real time elapsed since the last call, scaled by the speed multiplier
+void SimulationClock::Advance(std::uint32_t now) {
+  std::uint32_t elapsed = now - _last;
+  _last = now;
+  if (_speed == kUncapped) {
+    _accumulator = static_cast<std::uint64_t>(kUncappedBatch) * _tickDuration;
+    return;
+  }
+  _accumulator += static_cast<std::uint64_t>(elapsed) * _speed;
+  _accumulator = std::min<std::uint64_t>(_accumulator, static_cast<std::uint64_t>(kMaxCatchUpTicks) * _speed * _tickDuration);
+}
+
+// take one tick from the accumulator
+bool SimulationClock::ConsumeTick() {
+  if (_accumulator < _tickDuration) { return false; }
+  _accumulator -= _tickDuration;
+  return true;
+}
+
+// real time until the given number of ticks will be due (rounded up)
+std::uint32_t SimulationClock::GetTimeUntil(int ticks) const {
+  if (_speed == kUncapped) { return 0; }
+  std::uint64_t needed = static_cast<std::uint64_t>(ticks) * _tickDuration;
+  if (needed <= _accumulator) { return 0; }
+  std::uint64_t time = (needed - _accumulator + _speed - 1) / _speed;
+  return static_cast<std::uint32_t>(std::min<std::uint64_t>(time, UINT32_MAX));
+}
@@ -0,0 +1,39 @@
+#ifndef SIMULATION_CLOCK_H
+#define SIMULATION_CLOCK_H
+
+#include <cstdint>
+
+// fixed timestep clock of the simulation. real time (in ms) is collected in an accumulator and handed out in ticks of constant 
+// length, independent of how long rendering takes. all game timing (turns, timed effects) is counted in ticks, so the outcome of 
+// the simulation only depends on the sequence of ticks and the input, not on the frame rate
+// the speed multiplier runs the simulation faster than real time (e.g. for automated testing). kUncapped runs a batch of ticks 
+// per call, as fast as the machine allows
+class SimulationClock {
+ public:
+  static constexpr int kUncapped = 0;
+
+  SimulationClock(std::uint32_t tickDuration, int speed) : _tickDuration(tickDuration), _speed(speed) {}
+
+  // restart accumulating from now, discarding any collected time. used at start-up and while the game is paused
+  void Reset(std::uint32_t now);
+  // collect the real time elapsed since the last call
+  void Advance(std::uint32_t now);
+  // take one tick from the accumulator. returns false if no tick is due
+  bool ConsumeTick();
+  // real time until the given number of ticks will be due
+  std::uint32_t GetTimeUntil(int ticks) const;
+
+ private:
+  // upper limit for the time collected in the accumulator, e.g. if the process has been suspended. the simulation then lags 
+  // behind real time instead of running a long burst of ticks
+  static constexpr int kMaxCatchUpTicks = 60;
+  // ticks per call of Advance in uncapped mode, so input & rendering still get their turn
+  static constexpr int kUncappedBatch = 500;
+
+  std::uint32_t _tickDuration;
+  int _speed;
+  std::uint32_t _last{0};
+  std::uint64_t _accumulator{0};   // collected time in ms of simulation time
+};
+
+#endif
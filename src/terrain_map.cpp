@@ -0,0 +1,42 @@
+#include "terrain_map.h"
+
+// set size. all tiles are initialized as bedrock
+void TerrainMap::Init(int width, int height) {
+  _width = width;
+  _height = height;
+  _tiles.assign(width * height, Encode(MapTiles::Type::kBedrock));
+  _external = nullptr;
+  _revision++;
+}
+
+// use externally owned tiles without copying
+void TerrainMap::Attach(int width, int height, std::uint8_t const *tiles) {
+  _width = width;
+  _height = height;
+  _tiles.clear();
+  _external = tiles;
+  _revision++;
+}
+
+void TerrainMap::SetTile(Point point, MapTiles::Type type) {
+  if (!IsOnMap(point) || _external != nullptr) { return; }
+  _tiles[point.y * _width + point.x] = Encode(type);
+  _revision++;
+}
+
+// derive the tile byte from a tile type
+std::uint8_t TerrainMap::Encode(MapTiles::Type type) {
+  std::uint8_t tile = static_cast<std::uint8_t>(type) & kTypeMask;
+  switch (type) {
+    case MapTiles::Type::kFloor:
+    case MapTiles::Type::kGras:
+      tile |= kPassable;
+      break;
+    case MapTiles::Type::kBedrock:
+    case MapTiles::Type::kInnerWall:
+    case MapTiles::Type::kOuterWall:
+      tile |= kOpaque;
+      break;
+  }
+  return tile;
+}
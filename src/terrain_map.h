@@ -0,0 +1,47 @@
+#ifndef TERRAIN_MAP_H
+#define TERRAIN_MAP_H
+
+#include <cstdint>
+#include <vector>
+#include "point.h"
+#include "tiletypes.h"
+
+// packed terrain of the game map: one byte per tile (row-major, index = y * width + x)
+// the lower bits hold the tile type, the upper bits cache properties derived from it
+// tiles are either owned by the map or - for compiled levels - read in place from a memory-mapped level file
+class TerrainMap {
+ public:
+  enum Flags : std::uint8_t { kTypeMask = 0x0F, kPassable = 0x10, kOpaque = 0x20 };
+
+  // set size. all tiles are initialized as bedrock
+  void Init(int width, int height);
+
+  // use externally owned tiles (e.g. of a LevelFile) without copying. tiles must outlive the map and can't be changed via SetTile
+  void Attach(int width, int height, std::uint8_t const *tiles);
+
+  // setters & getters. positions outside the map are treated as bedrock
+  void SetTile(Point point, MapTiles::Type type);
+  MapTiles::Type GetType(Point point) const { return static_cast<MapTiles::Type>(Get(point) & kTypeMask); }
+  bool IsPassable(Point point) const { return (Get(point) & kPassable) != 0; }   // can be walked on
+  bool IsOpaque(Point point) const { return (Get(point) & kOpaque) != 0; }       // blocks the line of sight
+  bool IsOnMap(Point point) const { return point.x >= 0 && point.y >= 0 && point.x < _width && point.y < _height; }
+
+  int GetWidth() const { return _width; }
+  int GetHeight() const { return _height; }
+  std::uint8_t const *GetTiles() const { return _external != nullptr ? _external : _tiles.data(); }
+  unsigned int GetRevision() const { return _revision; }   // incremented whenever the map is set up or a tile changes, e.g. to re-bake a texture
+
+  // derive the tile byte from a tile type
+  static std::uint8_t Encode(MapTiles::Type type);
+
+ private:
+  std::uint8_t Get(Point point) const { return IsOnMap(point) ? GetTiles()[point.y * _width + point.x] : Encode(MapTiles::Type::kBedrock); }
+
+  int _width{0};
+  int _height{0};
+  std::vector<std::uint8_t> _tiles{};
+  std::uint8_t const *_external{nullptr};
+  unsigned int _revision{0};
+};
+
+#endif
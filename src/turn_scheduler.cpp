@@ -0,0 +1,19 @@
+#include "turn_scheduler.h"
+
+// schedule the first turn of a new combattant
+void TurnScheduler::Add(EntityHandle handle, std::uint64_t tick) {
+  _queue.push(Turn{tick, _nextOrder++, handle});
+}
+
+// schedule the next turn of a combattant, keeping its place in the order of combattants
+void TurnScheduler::Reschedule(Turn const &turn, std::uint64_t tick) {
+  _queue.push(Turn{tick, turn.order, turn.handle});
+}
+
+// remove the next turn from the heap, if it is due
+bool TurnScheduler::PopDue(std::uint64_t tick, Turn &turn) {
+  if (_queue.empty() || _queue.top().tick > tick) { return false; }
+  turn = _queue.top();
+  _queue.pop();
+  return true;
+}
@@ -0,0 +1,42 @@
+#ifndef TURN_SCHEDULER_H
+#define TURN_SCHEDULER_H
+
+#include <cstdint>
+#include <queue>
+#include <vector>
+#include "registry.h"
+
+// min-heap of upcoming combattant turns, keyed on the tick of the turn. a tick only touches the combattants whose turn it is,
+// instead of polling every combattant. turns due at the same tick are taken in the order the combattants were added, 
+// which matches the order of their registry, so the outcome doesn't depend on the heap layout
+// erased combattants are not removed from the heap: their stale handles are skipped when their turn comes up
+class TurnScheduler {
+ public:
+  struct Turn {
+    std::uint64_t tick;
+    std::uint32_t order;    // tie breaker for turns at the same tick
+    EntityHandle handle;
+  };
+
+  static constexpr std::uint64_t kNever = UINT64_MAX;
+
+  // schedule the first turn of a new combattant. it acts after all combattants added before it
+  void Add(EntityHandle handle, std::uint64_t tick);
+  // schedule the next turn of a combattant which has just taken a turn
+  void Reschedule(Turn const &turn, std::uint64_t tick);
+
+  // remove the next turn from the heap, if it is due at or before tick
+  bool PopDue(std::uint64_t tick, Turn &turn);
+  // tick of the next turn (kNever if none)
+  std::uint64_t GetNextTick() const { return _queue.empty() ? kNever : _queue.top().tick; }
+
+ private:
+  struct Later {
+    bool operator()(Turn const &a, Turn const &b) const { return a.tick != b.tick ? a.tick > b.tick : a.order > b.order; }
+  };
+
+  std::priority_queue<Turn, std::vector<Turn>, Later> _queue{};
+  std::uint32_t _nextOrder{0};
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef VISION_MASK_H
+#define VISION_MASK_H
+
+#include <array>
+#include <cstdint>
+
+// circular vision masks, generated at compile time for every vision radius
+// a mask covers the window of kSize x kSize tiles around the player, bit-packed: one word per row, bit x of row y is the tile
+// (x - kMaxRadius, y - kMaxRadius) relative to the player. testing a tile is a shift and a mask
+namespace VisionMasks {
+
+constexpr int kMaxRadius = 9;
+constexpr int kSize = 2 * kMaxRadius + 1;
+static_assert(kSize <= 32, "a row of the window must fit into a word");
+
+using Rows = std::array<std::uint32_t, kSize>;
+
+// tiles within the circle of the radius (the "pixel circle" dx^2 + dy^2 <= r^2 + r, which looks rounder than dx^2 + dy^2 <= r^2)
+// a negative radius yields an empty mask
+constexpr Rows Circle(int radius) {
+  Rows rows{};
+  for (int y = 0; y < kSize; y++) {
+    for (int x = 0; x < kSize; x++) {
+      int dx = x - kMaxRadius;
+      int dy = y - kMaxRadius;
+      if (radius >= 0 && dx * dx + dy * dy <= radius * radius + radius) { rows[y] |= std::uint32_t{1} << x; }
+    }
+  }
+  return rows;
+}
+
+constexpr bool Test(Rows const &rows, int x, int y) { return ((rows[y] >> x) & 1u) != 0; }
+
+// masks of all radii, for runtime selection
+constexpr std::array<Rows, kMaxRadius + 1> MakeCircles() {
+  std::array<Rows, kMaxRadius + 1> circles{};
+  for (int radius = 0; radius <= kMaxRadius; radius++) { circles[radius] = Circle(radius); }
+  return circles;
+}
+inline constexpr std::array<Rows, kMaxRadius + 1> kCircles = MakeCircles();
+
+} // end namespace VisionMasks
+
+// masks of a radius known at compile time: the visible circle and its inside. the fringe is the outermost ring of the circle
+template <int Radius>
+struct VisionMask {
+  static_assert(Radius >= 0 && Radius <= VisionMasks::kMaxRadius, "vision radius exceeds the window");
+
+  static constexpr VisionMasks::Rows kVisible = VisionMasks::Circle(Radius);
+  static constexpr VisionMasks::Rows kInside = VisionMasks::Circle(Radius - 1);
+};
+
+#endif